@@ -7,126 +7,208 @@
 
 #include "GitHubClient.h"
 
-String GitHubClient::getProfileData(const String User)
+// Bodies handed to GitHubClient::exchange, read() takes the transport or a GzipReader
+
+struct DocumentBody
 {
-    String profileJson = receiveData(String(String(profileURL) + User).c_str());
-    return profileJson;
-}
+    JsonDocument &doc;
+    DeserializationError error;
+
+    template <typename Reader>
+    void read(Reader &reader) { error = deserializeJson(doc, reader); }
+};
+
+struct StreamBody
+{
+    JsonStream &parser;
+
+    template <typename Reader>
+    void read(Reader &reader)
+    {
+        char chunk[128];
+        size_t length;
+        while ((length = reader.readBytes(chunk, sizeof(chunk))) > 0)
+            parser.feed(chunk, length);
+    }
+};
 
-String GitHubClient::getReposData(const String User)
+DeserializationError GitHubClient::getProfileData(const String User, JsonDocument &doc)
 {
-    String reposJson = receiveData(String(String(profileURL) + User + "/repos").c_str());
-    return reposJson;
+    char url[128];
+    snprintf(url, sizeof(url), "%s%s", profileURL, User.c_str());
+    return receiveData(url, doc);
 }
 
-String GitHubClient::getRepoData(const String repo, const String User)
+DeserializationError GitHubClient::getRepoData(const String repo, const String User, JsonDocument &doc)
 {
-    String repoJson = receiveData(String(String(reposURL) + User + "/" + repo).c_str());
-    return repoJson;
+    char url[192];
+    snprintf(url, sizeof(url), "%s%s/%s", reposURL, User.c_str(), repo.c_str());
+    return receiveData(url, doc);
 }
 
 /**
  * Fetch data from a given URL using HTTPS
  * @param URL The HTTPS URL to fetch data from
- * @return Response payload as a String, or empty string on failure
+ * @param doc Document the response is parsed into
+ * @return Parser result, EmptyInput if the request failed
  */
-String GitHubClient::receiveData(const char *URL)
+DeserializationError GitHubClient::receiveData(const char *URL, JsonDocument &doc)
 {
-    String response;
-    WiFiClientSecure client;
-    client.setInsecure();
+    static const HTTPHeader headers[] = {
+        {"Accept-Encoding", "gzip"}};
 
-    HTTPClient https;
+    const HTTPRequest request = {"GET", URL, headers, Network::UseGzip ? 1U : 0U, nullptr, 0};
+    return receive(request, doc);
+}
 
-    if (https.begin(client, URL))
-    {                               // Use the secure client
-        int httpCode = https.GET(); // Perform the GET request
+/**
+ * Fetch the contribution calendar of GITHUB_USERNAME for the query range of the wake
+ * The request body and headers are compile-time constants, only the dates
+ * are written into a stack buffer, so building the request does not touch
+ * the heap.
+ * @param context Wake context holding the date range
+ * @param doc Document the response is parsed into
+ * @return Parser result, EmptyInput if the request failed
+ */
+DeserializationError GitHubClient::getStatisticsData(const WakeContext &context, JsonDocument &doc)
+{
+    CalendarRequest query;
+    query.setRange(context.rangeFrom, context.rangeTo);
 
-        if (httpCode > 0)
-        {
-            if (httpCode == HTTP_CODE_OK)
-            {
-                response = https.getString();
-            }
-        }
-        else
-        {
-            Serial.printf("[HTTPS] GET failed, error: %s\n", https.errorToString(httpCode).c_str());
-        }
+    const size_t headerCount = Network::UseGzip ? 3 : 2;
+    const HTTPRequest request = {"POST", graphQLBaseURL, GraphQL::Headers, headerCount, query.body(), query.length()};
+    DeserializationError error = receive(request, doc);
 
-        https.end(); // Free resources
-    }
-    else
+    JsonObject rateLimit = doc["data"]["rateLimit"];
+    if (!error && !rateLimit.isNull())
     {
-        Serial.println("[HTTPS] Unable to connect");
+        RateLimit::updateGraphQL(rateLimit["cost"].as<uint16_t>(),
+                                 rateLimit["remaining"].as<uint32_t>(),
+                                 rateLimit["resetAt"].as<const char *>());
     }
-    return response;
+
+    return error;
 }
 
-String GitHubClient::getStatisticsData(const String User)
+/**
+ * Fetch the contribution calendars and profiles of all users of TeamConfig
+ * in one GraphQL request
+ * @param context Wake context holding the date range
+ * @param parser Receives the response body while it arrives
+ * @return false if the request failed or the response was incomplete
+ */
+bool GitHubClient::getTeamData(const WakeContext &context, TeamParser &parser)
 {
-    HTTPHeader headers[] = {
-        {"Authorization", String("Bearer ") + GITHUB_PAT},
-        {"Content-Type", "application/json"}};
+    TeamRequest query;
+    if (!query.build(context.rangeFrom, context.rangeTo))
+        return false;
 
-    char date1[11];
-    char date2[11];
+    return post(query.body(), query.length(), parser) && parser.ok();
+}
 
-    TimeManager time;
-    time.begin();
+/**
+ * Fetch one page of the public repositories of a user
+ * @param User Owner of the repositories
+ * @param cursor End cursor of the previous page, nullptr for the first page
+ * @param parser Reduces the page into its summary while it arrives
+ * @return false if the request failed or the page was incomplete
+ */
+bool GitHubClient::getRepoPage(const String User, const char *cursor, RepoParser &parser)
+{
+    RepoRequest query;
+    if (!query.build(User.c_str(), cursor))
+        return false;
 
-    tm dateRaw = time.getLocalTime();
+    return post(query.body(), query.length(), parser) && parser.ok();
+}
 
-    sprintf(date1, "%04d-%02d-%02d",
-            dateRaw.tm_year + 1900,
-            dateRaw.tm_mon + 1,
-            dateRaw.tm_mday);
+/**
+ * Send a GraphQL request and stream the response into a parser
+ * @param body Request body
+ * @param length Length of the body
+ * @param stream Receives the response body while it arrives
+ * @return false if the request failed or the response was incomplete
+ */
+bool GitHubClient::post(const char *body, const size_t length, GraphQLStream &stream)
+{
+    StreamBody response = {stream};
+    const size_t headerCount = Network::UseGzip ? 3 : 2;
+    const HTTPRequest request = {"POST", graphQLBaseURL, GraphQL::Headers, headerCount, body, length};
 
-    time_t adjusted = mktime(&dateRaw);
-    const int n = time.getWeekday() == 7 ? 0 : time.getWeekday();
-    adjusted -= (time_t)n * 24 * 60 * 60;
+    if (exchange(request, response) != 200 || !stream.complete())
+        return false;
 
-    localtime_r(&adjusted, &dateRaw);
+    if (stream.cost() > 0)
+        RateLimit::updateGraphQL(stream.cost(), stream.remaining(), stream.resetAt());
 
-    sprintf(date2, "%04d-%02d-%02d",
-            dateRaw.tm_year + 1899,
-            dateRaw.tm_mon + 1,
-            dateRaw.tm_mday);
-            
-    String graphQLQuery = String("{\"query\":\"query { user(login: \\\"") + User + "\\\") { contributionsCollection(from: \\\"" + String(date2) + "T00:00:00Z\\\", to: \\\"" + String(date1) + "T23:59:59Z\\\") { contributionCalendar { totalContributions weeks { contributionDays { date contributionCount } } } } } }\"}";
+    return true;
+}
 
-    return receiveHTTPSData(graphQLBaseURL, graphQLQuery, headers, 2);
+/**
+ * Perform a request and parse the response body while it is received
+ * @param request Request to send
+ * @param doc Document the response is parsed into
+ * @return Parser result, EmptyInput if the request failed
+ */
+DeserializationError GitHubClient::receive(const HTTPRequest &request, JsonDocument &doc)
+{
+    DocumentBody body = {doc, DeserializationError::InvalidInput};
+    return exchange(request, body) == 200 ? body.error : DeserializationError::EmptyInput;
 }
 
-String GitHubClient::receiveHTTPSData(const char *URL, const String query, const HTTPHeader header[], const int HeaderSize)
+/**
+ * Perform a request and hand the body to a reader, inflated if it is gzipped
+ * @param request Request to send
+ * @param body Reads the body with read(reader) on success
+ * @return HTTP status code, or a value <= 0 on transport errors
+ */
+template <typename Body>
+int GitHubClient::exchange(const HTTPRequest &request, Body &body)
 {
-    String response;
-    WiFiClientSecure client;
-    client.setInsecure();
+    PlatformTransport transport;
+    uint32_t inflatedBytes = 0;
 
-    HTTPClient https;
-    if (https.begin(client, URL))
+    int httpCode = transport.begin(request);
+
+    if (httpCode > 0)
     {
-        for (int i = 0; i < HeaderSize; i++)
-        {
-            https.addHeader(header[i].key, header[i].value);
-        }
+        MemoryTelemetry::sample(Checkpoint::TLS);
+        RateLimit::update(transport);
+        TimeManager::correct(transport.header("Date"));
+    }
 
-        int httpCode = https.POST(query); // Perform the GET request
+    if (httpCode == 200)
+    {
+        const char *encoding = transport.header("Content-Encoding");
 
-        if (httpCode > 0)
+        if (encoding != nullptr && strcmp(encoding, "gzip") == 0)
         {
-            if (httpCode == HTTP_CODE_OK)
-            {
-                response = https.getString();
-            }
+            GzipReader gzip(transport, Network::GzipInputBuffer);
+            if (gzip.begin())
+                body.read(gzip);
+            inflatedBytes = gzip.inflatedBytes();
         }
         else
         {
-            Serial.printf("[HTTPS] GET failed, error: %s\n", https.errorToString(httpCode).c_str());
+            body.read(transport);
         }
 
-        https.end(); // Free resources
+        MemoryTelemetry::sample(Checkpoint::Parse);
     }
-    return response;
-}
\ No newline at end of file
+    else if (httpCode > 0)
+    {
+        Serial.printf("[HTTPS] %s %s returned %d\n", request.method, request.url, httpCode);
+    }
+
+    transport.end(); // Free resources
+
+    const HTTPTiming &timing = transport.timing();
+    Serial.printf("[HTTPS] %s %s: headers after %lu ms, done after %lu ms, %lu bytes received",
+                  request.method, request.url,
+                  (unsigned long)timing.headersMs, (unsigned long)timing.totalMs, (unsigned long)timing.bytesReceived);
+    if (inflatedBytes > 0)
+        Serial.printf(" (gzip, %lu bytes inflated)", (unsigned long)inflatedBytes);
+    Serial.println();
+
+    return httpCode;
+}
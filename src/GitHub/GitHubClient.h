@@ -6,12 +6,19 @@
  */
 
 #include <Arduino.h>
-#include <HTTPClient.h>       // HTTP client for API calls
-#include <WiFiClientSecure.h> // Secure HTTPS client
+#include <ArduinoJson.h>
 
+#include "../config/networkConfig.h"
 #include "../models/HTTPHeader.h"
-#include "../models/deviceInformation.h"
+#include "../models/wakeContext.h"
+#include "../profiler/MemoryTelemetry.h"
 #include "../time/TimeManager.h"
+#include "../transport/GzipReader.h"
+#include "GraphQLRequest.h"
+#include "RateLimit.h"
+#include "RepoParser.h"
+#include "TeamParser.h"
+#include "../transport/platformTransport.h"
 #include "resources/credentials.h"
 
 #pragma once
@@ -20,15 +27,19 @@ class GitHubClient
 {
 public:
     void init(const String username);
-    String getProfileData(const String User);
-    String getStatisticsData(const String User);
-    String getReposData(const String User);
-    String getRepoData(const String repo, const String User);
+    DeserializationError getProfileData(const String User, JsonDocument &doc);
+    DeserializationError getStatisticsData(const WakeContext &context, JsonDocument &doc);
+    DeserializationError getRepoData(const String repo, const String User, JsonDocument &doc);
+    bool getTeamData(const WakeContext &context, TeamParser &parser);
+    bool getRepoPage(const String User, const char *cursor, RepoParser &parser);
 
 private:
-    char *profileURL = "https://api.github.com/users/";
-    char *reposURL = "https://api.github.com/repos/";
-    char *graphQLBaseURL = "https://api.github.com/graphql";
-    String receiveData(const char *URL);
-    String receiveHTTPSData(const char *URL, const String query, const HTTPHeader header[], const int HeaderSize);
-};
\ No newline at end of file
+    const char *profileURL = GITHUB_API_URL "/users/";
+    const char *reposURL = GITHUB_API_URL "/repos/";
+    const char *graphQLBaseURL = GITHUB_API_URL "/graphql";
+    DeserializationError receiveData(const char *URL, JsonDocument &doc);
+    DeserializationError receive(const HTTPRequest &request, JsonDocument &doc);
+    bool post(const char *body, const size_t length, GraphQLStream &stream);
+    template <typename Body>
+    int exchange(const HTTPRequest &request, Body &body);
+};
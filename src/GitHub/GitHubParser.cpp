@@ -19,10 +19,8 @@ GitHubProfile *GitHubParser::getProfile()
 
 GitHubProfile *GitHubParser::getProfile(const String User)
 {
-    GitHubProfile *profile = new GitHubProfile;
-    JsonDocument doc;
-    String profileJson = client.getProfileData(User);
-    DeserializationError error = deserializeJson(doc, profileJson);
+    JsonDocument doc(ArenaAllocator::instance());
+    DeserializationError error = client.getProfileData(User, doc);
     if (error)
     {
         Serial.print("Error occured while fetching the profile: ");
@@ -30,133 +28,179 @@ GitHubProfile *GitHubParser::getProfile(const String User)
         return nullptr;
     }
 
+    GitHubProfile *profile = Arena::wake().create<GitHubProfile>();
+    if (profile == nullptr)
+        return nullptr;
+
+    profile->username = doc["login"].as<const char *>();
     profile->followers = doc["followers"].as<int>();    
     profile->following = doc["following"].as<int>();
     profile->publicGists = doc["public_gists"].as<int>();
     profile->publicRepos = doc["public_repos"].as<int>();
-    profile->bio = doc["bio"].as<String>();
-    profile->blog = doc["blog"].as<String>();
-    profile->company = doc["company"].as<String>();
-    profile->email = doc["email"].as<String>();
-    profile->name = doc["name"].as<String>();
-    profile->twitterUsername = doc["twitter_username"].as<String>();
+    profile->bio = doc["bio"].as<const char *>();
+    profile->blog = doc["blog"].as<const char *>();
+    profile->company = doc["company"].as<const char *>();
+    profile->email = doc["email"].as<const char *>();
+    profile->name = doc["name"].as<const char *>();
+    profile->twitterUsername = doc["twitter_username"].as<const char *>();
 
     return profile;
 }
 
-GitHubRepo *GitHubParser::getRepos(const int amount)
+GitHubRepo *GitHubParser::getRepo(const String repoName)
 {
-    return getRepos(_user, amount);
+    return getRepo(repoName, _user);
 }
 
-GitHubRepo *GitHubParser::getRepos(const String User, const int amount)
+GitHubRepo *GitHubParser::getRepo(const String repoName, const String User)
 {
-    GitHubRepo *repos = new GitHubRepo[amount];
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, client.getReposData(User));
+    JsonDocument doc(ArenaAllocator::instance());
+    DeserializationError error = client.getRepoData(repoName, User, doc);
 
     if (error)
     {
-        Serial.print("Error occured while fetching repos: ");
+        Serial.print("Error occured while fetching repo: ");
         Serial.println(error.c_str());
         return nullptr;
     }
 
-    for (int i = 0; i < amount; i++)
-    {
-        GitHubRepo repo;
-        repo.description = doc[i]["description"].as<String>();
-        repo.language = doc[i]["language"].as<String>();
-        repo.license = doc[i]["license"].as<String>();
-        repo.name = doc[i]["name"].as<String>();
-        repo.stargazers = doc[i]["stargazers_count"].as<int>();
-        repo.watchers = doc[i]["watchers_count"].as<int>();
-        repos[i] = repo;
-    }
+    GitHubRepo *repo = Arena::wake().create<GitHubRepo>();
+    if (repo == nullptr)
+        return nullptr;
 
-    return repos;
-}
+    repo->description = doc["description"].as<const char *>();
+    repo->language = doc["language"].as<const char *>();
+    repo->license = doc["license"]["spdx_id"].as<const char *>();
+    repo->name = doc["name"].as<const char *>();
+    repo->stargazers = doc["stargazers_count"].as<int>();
+    repo->watchers = doc["watchers_count"].as<int>();
 
-GitHubRepo *GitHubParser::getRepo(const String repoName)
-{
-    return getRepo(repoName, _user);
+    return repo;
 }
 
-GitHubRepo *GitHubParser::getRepo(const String repoName, const String User)
+GitHubStats *GitHubParser::getStatistics(const WakeContext &context)
 {
-    GitHubRepo *repo = new GitHubRepo;
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, client.getReposData(User));
+    JsonDocument doc(ArenaAllocator::instance());
+    DeserializationError error = client.getStatisticsData(context, doc);
 
     if (error)
     {
-        Serial.print("Error occured while fetching repos: ");
+        Serial.print("Error occured while fetching profile statistics: ");
         Serial.println(error.c_str());
         return nullptr;
     }
 
-    repo->description = doc["description"].as<String>();
-    repo->language = doc["language"].as<String>();
-    repo->license = doc["license"].as<String>();
-    repo->name = doc["name"].as<String>();
-    repo->stargazers = doc["stargazers_count"].as<int>();
-    repo->watchers = doc["watchers_count"].as<int>();
+    GitHubStats *stats = Arena::wake().create<GitHubStats>();
+    if (stats == nullptr)
+        return nullptr;
 
-    return repo;
+    JsonObject calendar = doc["data"]["user"]["contributionsCollection"]["contributionCalendar"];
+    stats->contributions = calendar["totalContributions"].as<int>();
+
+    // The first week may start mid week, every day is placed by its date
+    // counted from the Sunday before the first one
+    const size_t total = sizeof(stats->commits) / sizeof(stats->commits[0]);
+    for (JsonObject week : calendar["weeks"].as<JsonArray>())
+    {
+        for (JsonObject day : week["contributionDays"].as<JsonArray>())
+        {
+            const int32_t date = TimeUtils::parseDate(day["date"].as<const char *>());
+            if (date <= 0)
+                continue;
+
+            if (stats->firstDay == 0)
+            {
+                stats->firstDay = date;
+                stats->startDay = date - TimeUtils::weekdayFromDays(date);
+            }
+
+            const int32_t index = date - stats->startDay;
+            const uint32_t count = day["contributionCount"].as<uint32_t>();
+            if (index >= 0 && (size_t)index < total)
+                stats->commits[index] = count > UINT16_MAX ? UINT16_MAX : count;
+        }
+    }
+
+    if (stats->firstDay == 0)
+    {
+        Serial.println("Error occured while fetching profile statistics: no contribution days");
+        return nullptr;
+    }
+
+    // Streaks, maximum and average are maintained by the StatisticsEngine
+    return stats;
 }
 
-GitHubStats *GitHubParser::getStatistics(const uint8_t currentWeekday)
+/**
+ * Fetch profiles and calendars of all users of TeamConfig with one request
+ * @param context Wake context holding the date range
+ * @return Members in the order of TeamConfig::Users, members missing from
+ *         the response are not valid. nullptr if the request failed.
+ */
+TeamMember *GitHubParser::getTeam(const WakeContext &context)
 {
-    JsonDocument doc;
-    String statsJson = client.getStatisticsData(_user);
-    DeserializationError error = deserializeJson(doc, statsJson);
-    GitHubStats *stats = new GitHubStats;
+    TeamMember *members = Arena::wake().createArray<TeamMember>(TeamConfig::UserCount);
+    if (members == nullptr)
+        return nullptr;
 
-    if (error)
+    TeamParser parser(members, TeamConfig::UserCount);
+    if (!client.getTeamData(context, parser))
     {
-        Serial.print("Error occured while fetching profile statistics: ");
-        Serial.println(error.c_str());
+        Serial.println("Error occured while fetching the team calendars");
+        return nullptr;
     }
 
-    // Initialize statistics variables
-    int streak = 0; // Temporary streak counter
+    // Streaks, maximum and average are computed before the members are stored
+    return members;
+}
 
-    stats->contributions = doc["data"]["user"]["contributionsCollection"]["contributionCalendar"]["totalContributions"].as<int>();
-    for (int i = 0; i <= 371; i++)
-    {
-        stats->commits[i] = doc["data"]["user"]["contributionsCollection"]["contributionCalendar"]["weeks"][i / 7]["contributionDays"][i % 7]["contributionCount"].as<int>();
+RepoSummary *GitHubParser::scanRepos(const uint32_t deadline)
+{
+    return scanRepos(_user, deadline);
+}
 
-        // Calculate longest streak
-        if (stats->commits[i] > 0)
+/**
+ * Page through all public repositories of a user and reduce them into one
+ * summary, only the page being received is parsed at any time
+ * @param User Owner of the repositories
+ * @param deadline millis() after which no further page is requested
+ * @return Finished summary, nullptr if a page failed, the deadline passed or
+ *         the repositories did not fit into RepoConfig::MaxPages pages
+ */
+RepoSummary *GitHubParser::scanRepos(const String User, const uint32_t deadline)
+{
+    RepoSummary *summary = Arena::wake().create<RepoSummary>();
+    if (summary == nullptr)
+        return nullptr;
+
+    char cursor[64] = "";
+    for (uint16_t page = 0; page < RepoConfig::MaxPages; page++)
+    {
+        // Partial totals would understate the stars, keep the cached ones
+        if (page > 0 && RequestExecutor::passed(deadline))
         {
-            streak++;
-            if (streak > stats->longestStreak)
-                stats->longestStreak = streak;
+            Serial.printf("[Repos] Deadline passed after %u pages\n", page);
+            return nullptr;
         }
-        else
+
+        RepoParser parser(*summary);
+        if (!client.getRepoPage(User, page == 0 ? nullptr : cursor, parser))
         {
-            streak = 0;
+            Serial.printf("Error occured while fetching repo page %u\n", page + 1);
+            return nullptr;
         }
 
-        // Calculate max contributions in a day
-        if (stats->commits[i] > stats->maxContributions)
+        if (!parser.hasNextPage() || parser.endCursor()[0] == '\0')
         {
-            stats->maxContributions = stats->commits[i];
+            summary->finish();
+            return summary;
         }
-    }
-
-    // Calculate average contributions per day, rounded to 2 decimal places
-    stats->averageContributions = (float)stats->contributions / (365 + currentWeekday);
-    stats->averageContributions = roundf(stats->averageContributions * 100) / 100;
 
-    // Calculate current active streak (consecutive days from today backwards)
-    for (int i = 371 - (7 - currentWeekday); i >= 0; i--)
-    {
-        if (stats->commits[i] > 0)
-            stats->currentStreak++;
-        else
-            break;
+        strlcpy(cursor, parser.endCursor(), sizeof(cursor));
     }
 
-    return stats;
-}
\ No newline at end of file
+    // The owner has more repositories than the scan covers, the stars of the
+    // pages read would understate the total, keep the cached ones
+    Serial.printf("[Repos] Stopped after %u pages\n", (unsigned)RepoConfig::MaxPages);
+    return nullptr;
+}
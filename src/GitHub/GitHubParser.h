@@ -12,19 +12,26 @@
 #include "../models/GitHubProfile.h"
 #include "../models/GitHubStats.h"
 #include "../models/GitHubRepo.h"
+#include "../models/TeamMember.h"
+#include "../config/teamConfig.h"
+#include "../memory/Arena.h"
+#include "../statistics/RepoSummary.h"
 #include "GitHubClient.h"
+#include "RequestExecutor.h"
 
 class GitHubParser
 {
 public:
+    // Results live in the wake arena and stay valid until it is reset
     explicit GitHubParser(const String User);
     GitHubProfile *getProfile();
     GitHubProfile *getProfile(const String User);
-    GitHubStats *getStatistics(const uint8_t currentWeekday);
+    GitHubStats *getStatistics(const WakeContext &context);
+    TeamMember *getTeam(const WakeContext &context);
     GitHubRepo *getRepo(const String repoName);
     GitHubRepo *getRepo(const String repoName, const String User);
-    GitHubRepo *getRepos(int amount);
-    GitHubRepo *getRepos(const String User, const int amount);
+    RepoSummary *scanRepos(const uint32_t deadline);
+    RepoSummary *scanRepos(const String User, const uint32_t deadline);
 
 private:
     GitHubClient client;
@@ -0,0 +1,185 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Compile-time GraphQL request template for the contribution
+ *              calendar. Username and token are baked in as constant fragments,
+ *              only the date range is written at runtime into a fixed buffer.
+ *              The team request asks for several users at once through aliases,
+ *              the repository request pages through all repositories by cursor.
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "config/repoConfig.h"
+#include "config/teamConfig.h"
+#include "memory/Arena.h"
+#include "models/HTTPHeader.h"
+#include "resources/credentials.h"
+
+namespace GraphQL
+{
+    // "YYYY-MM-DD"
+    constexpr size_t DateLength = 10;
+
+    constexpr char CalendarPrefix[] =
+        "{\"query\":\"query { user(login: \\\"" GITHUB_USERNAME "\\\") { contributionsCollection(from: \\\"";
+    constexpr char CalendarMiddle[] = "T00:00:00Z\\\", to: \\\"";
+    constexpr char CalendarSuffix[] =
+        "T23:59:59Z\\\") { contributionCalendar { totalContributions weeks { contributionDays { date contributionCount } } } } } "
+        "rateLimit { cost remaining resetAt } }\"}";
+
+    // Users are aliased u0, u1, ... and share one fragment and the date range
+    constexpr char TeamPrefix[] = "{\"query\":\"query($from: DateTime!, $to: DateTime!) { ";
+    constexpr char TeamUser[] = "u%u: user(login: \\\"%s\\\") { ...member } ";
+    constexpr char TeamFragment[] =
+        "rateLimit { cost remaining resetAt } } "
+        "fragment member on User { login name bio company email websiteUrl twitterUsername "
+        "followers { totalCount } following { totalCount } gists { totalCount } "
+        "repositories(privacy: PUBLIC, ownerAffiliations: OWNER) { totalCount } "
+        "contributionsCollection(from: $from, to: $to) { contributionCalendar { totalContributions "
+        "weeks { firstDay contributionDays { contributionCount } } } } }\",\"variables\":{\"from\":\"";
+    constexpr char TeamMiddle[] = "T00:00:00Z\",\"to\":\"";
+    constexpr char TeamSuffix[] = "T23:59:59Z\"}}";
+
+    // One page of repositories, sizes of the languages are only available here
+    constexpr char RepoPage[] =
+        "{\"query\":\"query($login: String!, $after: String) { user(login: $login) { "
+        "repositories(first: %u, after: $after, privacy: PUBLIC, ownerAffiliations: OWNER) { "
+        "pageInfo { hasNextPage endCursor } nodes { name description stargazerCount forkCount "
+        "primaryLanguage { name } licenseInfo { spdxId } watchers { totalCount } "
+        "languages(first: %u, orderBy: {field: SIZE, direction: DESC}) { edges { size node { name } } } } } } "
+        "rateLimit { cost remaining resetAt } }\",\"variables\":{\"login\":\"%s\",\"after\":%s%s%s}}";
+
+    constexpr HTTPHeader Headers[] = {
+        {"Authorization", "Bearer " GITHUB_PAT},
+        {"Content-Type", "application/json"},
+        {"Accept-Encoding", "gzip"}};
+
+    /**
+     * Write a date as YYYY-MM-DD without a terminator
+     * @param out Destination with room for DateLength characters
+     * @param date Broken down date to write
+     */
+    inline void writeDate(char *out, const tm &date)
+    {
+        int year = date.tm_year + 1900;
+        for (int i = 3; i >= 0; i--, year /= 10)
+            out[i] = '0' + year % 10;
+        out[4] = '-';
+        out[5] = '0' + (date.tm_mon + 1) / 10;
+        out[6] = '0' + (date.tm_mon + 1) % 10;
+        out[7] = '-';
+        out[8] = '0' + date.tm_mday / 10;
+        out[9] = '0' + date.tm_mday % 10;
+    }
+}
+
+class CalendarRequest
+{
+public:
+    static constexpr size_t FromOffset = sizeof(GraphQL::CalendarPrefix) - 1;
+    static constexpr size_t MiddleOffset = FromOffset + GraphQL::DateLength;
+    static constexpr size_t ToOffset = MiddleOffset + sizeof(GraphQL::CalendarMiddle) - 1;
+    static constexpr size_t SuffixOffset = ToOffset + GraphQL::DateLength;
+    static constexpr size_t Length = SuffixOffset + sizeof(GraphQL::CalendarSuffix) - 1;
+
+    CalendarRequest()
+    {
+        memcpy(_body, GraphQL::CalendarPrefix, FromOffset);
+        memcpy(_body + MiddleOffset, GraphQL::CalendarMiddle, ToOffset - MiddleOffset);
+        memcpy(_body + SuffixOffset, GraphQL::CalendarSuffix, sizeof(GraphQL::CalendarSuffix));
+    }
+
+    void setRange(const tm &from, const tm &to)
+    {
+        GraphQL::writeDate(_body + FromOffset, from);
+        GraphQL::writeDate(_body + ToOffset, to);
+    }
+
+    const char *body() const { return _body; }
+    size_t length() const { return Length; }
+
+private:
+    char _body[Length + 1];
+};
+
+class TeamRequest
+{
+public:
+    /**
+     * Write the request for all users of TeamConfig into the wake arena
+     * @return false if the arena is exhausted
+     */
+    bool build(const tm &from, const tm &to)
+    {
+        size_t capacity = sizeof(GraphQL::TeamPrefix) + sizeof(GraphQL::TeamFragment) +
+                          sizeof(GraphQL::TeamMiddle) + sizeof(GraphQL::TeamSuffix) + 2 * GraphQL::DateLength;
+        for (uint8_t i = 0; i < TeamConfig::UserCount; i++)
+            capacity += sizeof(GraphQL::TeamUser) + strlen(TeamConfig::Users[i]);
+
+        _body = static_cast<char *>(Arena::wake().allocate(capacity));
+        if (_body == nullptr)
+            return false;
+
+        char *out = _body;
+        out = append(out, GraphQL::TeamPrefix);
+        for (uint8_t i = 0; i < TeamConfig::UserCount; i++)
+            out += snprintf(out, capacity - (out - _body), GraphQL::TeamUser, (unsigned)i, TeamConfig::Users[i]);
+        out = append(out, GraphQL::TeamFragment);
+        GraphQL::writeDate(out, from);
+        out = append(out + GraphQL::DateLength, GraphQL::TeamMiddle);
+        GraphQL::writeDate(out, to);
+        out = append(out + GraphQL::DateLength, GraphQL::TeamSuffix);
+
+        _length = out - _body;
+        return true;
+    }
+
+    const char *body() const { return _body; }
+    size_t length() const { return _length; }
+
+private:
+    static char *append(char *out, const char *text)
+    {
+        const size_t length = strlen(text);
+        memcpy(out, text, length + 1);
+        return out + length;
+    }
+
+    char *_body = nullptr;
+    size_t _length = 0;
+};
+
+class RepoRequest
+{
+public:
+    /**
+     * Write the request for one page of repositories
+     * @param login User whose repositories are listed
+     * @param cursor End cursor of the previous page, nullptr for the first page
+     * @return false if login and cursor do not fit into the buffer
+     */
+    bool build(const char *login, const char *cursor)
+    {
+        const int length = cursor == nullptr
+                               ? snprintf(_body, sizeof(_body), GraphQL::RepoPage, (unsigned)RepoConfig::PageSize,
+                                          (unsigned)RepoConfig::LanguagesPerRepo, login, "", "null", "")
+                               : snprintf(_body, sizeof(_body), GraphQL::RepoPage, (unsigned)RepoConfig::PageSize,
+                                          (unsigned)RepoConfig::LanguagesPerRepo, login, "\"", cursor, "\"");
+
+        _length = length > 0 && (size_t)length < sizeof(_body) ? length : 0;
+        return _length > 0;
+    }
+
+    const char *body() const { return _body; }
+    size_t length() const { return _length; }
+
+private:
+    char _body[sizeof(GraphQL::RepoPage) + 160];
+    size_t _length = 0;
+};
@@ -0,0 +1,37 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Streaming GraphQL response, handles the rate limit and the
+ *              errors of a response and hands everything else to a subclass.
+ */
+
+#include "GraphQLStream.h"
+
+void GraphQLStream::opening(const bool object)
+{
+    if (!object && depth() == 1 && isKey("errors"))
+        _errors = true;
+}
+
+void GraphQLStream::value(const bool text)
+{
+    if (depth() == 3 && strcmp(path(2), "rateLimit") == 0)
+    {
+        if (isKey("cost"))
+            _cost = strtoul(token(), nullptr, 10);
+        else if (isKey("remaining"))
+            _remaining = strtoul(token(), nullptr, 10);
+        else if (isKey("resetAt"))
+            strlcpy(_resetAt, token(), sizeof(_resetAt));
+    }
+    else if (_errors && depth() >= 2 && strcmp(path(1), "errors") == 0)
+    {
+        if (text && isKey("message"))
+            Serial.printf("[GraphQL] %s\n", token());
+    }
+    else
+    {
+        dataValue(text);
+    }
+}
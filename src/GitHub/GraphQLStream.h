@@ -0,0 +1,35 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Streaming GraphQL response, handles the rate limit and the
+ *              errors of a response and hands everything else to a subclass.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "JsonStream.h"
+
+class GraphQLStream : public JsonStream
+{
+public:
+    // Rate limit reported with the response, cost is 0 if it was missing
+    uint16_t cost() const { return _cost; }
+    uint32_t remaining() const { return _remaining; }
+    const char *resetAt() const { return _resetAt; }
+
+protected:
+    void opening(const bool object) override;
+    void value(const bool text) override;
+
+    // Called for values that are not part of rateLimit or errors
+    virtual void dataValue(const bool text) = 0;
+
+private:
+    bool _errors = false;
+    uint16_t _cost = 0;
+    uint32_t _remaining = 0;
+    char _resetAt[24] = "";
+};
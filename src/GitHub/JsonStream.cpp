@@ -0,0 +1,194 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Push tokenizer for JSON responses that are reduced while they
+ *              arrive. The body is fed in chunks of any size, subclasses get
+ *              every value together with its key and the keys of the
+ *              enclosing objects, no document is built.
+ */
+
+#include "JsonStream.h"
+
+/**
+ * Parse the next chunk of the response body
+ */
+void JsonStream::feed(const char *data, const size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+        feed(data[i]);
+}
+
+void JsonStream::feed(const char c)
+{
+    switch (_state)
+    {
+    case State::String:
+        if (c == '\\')
+            _state = State::Escape;
+        else if (c == '"')
+            endString();
+        else
+            append(c);
+        return;
+
+    case State::Escape:
+        _state = State::String;
+        if (c == 'u')
+        {
+            _state = State::Unicode;
+            _unicode = 0;
+            _unicodeDigits = 0;
+        }
+        else if (c == 'n')
+            append('\n');
+        else if (c == 't')
+            append('\t');
+        else if (c != 'r' && c != 'b' && c != 'f')
+            append(c);
+        return;
+
+    case State::Unicode:
+        _unicode = (_unicode << 4) | (c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+        if (++_unicodeDigits == 4)
+        {
+            appendUtf8(_unicode);
+            _state = State::String;
+        }
+        return;
+
+    case State::Literal:
+        if (c != ',' && c != '}' && c != ']' && c != ' ' && c != '\n' && c != '\r' && c != '\t')
+        {
+            append(c);
+            return;
+        }
+        endLiteral();
+        break; // The delimiter is handled below
+
+    case State::Value:
+        break;
+    }
+
+    switch (c)
+    {
+    case '{':
+        open(true);
+        break;
+    case '[':
+        open(false);
+        break;
+    case '}':
+    case ']':
+        close();
+        break;
+    case ',':
+        _expectKey = _depth > 0 && _depth <= 32 && ((_objects >> (_depth - 1)) & 1);
+        break;
+    case ':':
+        _expectKey = false;
+        break;
+    case '"':
+        _state = State::String;
+        _tokenLength = 0;
+        break;
+    case ' ':
+    case '\n':
+    case '\r':
+    case '\t':
+        break;
+    default:
+        _state = State::Literal;
+        _tokenLength = 0;
+        append(c);
+        break;
+    }
+}
+
+/**
+ * Enter an object or array, the current key becomes its path element
+ */
+void JsonStream::open(const bool object)
+{
+    if (_depth == 0)
+        _root = true;
+
+    opening(object);
+
+    if (_depth < MaxDepth)
+        strlcpy(_path[_depth], _key, KeyLength);
+    if (_depth < 32)
+        _objects = object ? _objects | (1UL << _depth) : _objects & ~(1UL << _depth);
+
+    _depth++;
+    _key[0] = '\0';
+    _expectKey = object;
+}
+
+void JsonStream::close()
+{
+    if (_depth == 0)
+        return;
+
+    _depth--;
+    _expectKey = false;
+    closed();
+
+    // The last key inside the closed container must not lead to the next
+    // array element, objects set a new key before their next value
+    if (_depth > 0 && _depth <= 32 && !((_objects >> (_depth - 1)) & 1))
+        _key[0] = '\0';
+}
+
+void JsonStream::endString()
+{
+    _state = State::Value;
+    _token[_tokenLength] = '\0';
+
+    if (_expectKey)
+    {
+        strlcpy(_key, _token, KeyLength);
+        _expectKey = false;
+    }
+    else
+    {
+        value(true);
+    }
+}
+
+void JsonStream::endLiteral()
+{
+    _state = State::Value;
+    _token[_tokenLength] = '\0';
+    value(false);
+}
+
+void JsonStream::append(const char c)
+{
+    // The models truncate cut texts at a character boundary
+    if (_tokenLength < TokenLength - 1)
+        _token[_tokenLength++] = c;
+}
+
+void JsonStream::appendUtf8(const uint16_t code)
+{
+    if (code < 0x80)
+    {
+        append(code);
+    }
+    else if (code < 0x800)
+    {
+        append(0xC0 | code >> 6);
+        append(0x80 | (code & 0x3F));
+    }
+    else if (code >= 0xD800 && code <= 0xDFFF)
+    {
+        append('?'); // Surrogate pairs are not combined
+    }
+    else
+    {
+        append(0xE0 | code >> 12);
+        append(0x80 | (code >> 6 & 0x3F));
+        append(0x80 | (code & 0x3F));
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Push tokenizer for JSON responses that are reduced while they
+ *              arrive. The body is fed in chunks of any size, subclasses get
+ *              every value together with its key and the keys of the
+ *              enclosing objects, no document is built.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+class JsonStream
+{
+public:
+    virtual ~JsonStream() = default;
+
+    void feed(const char *data, const size_t length);
+
+    // The whole document was received
+    bool complete() const { return _root && _depth == 0; }
+
+protected:
+    static constexpr uint8_t MaxDepth = 12;
+    static constexpr uint8_t KeyLength = 32;
+    // Largest text of a model plus the terminator, longer texts are cut
+    static constexpr uint16_t TokenLength = 257;
+
+    // Called before an object or array is entered, key() leads to it
+    virtual void opening(const bool object) {}
+    // Called after an object or array was left
+    virtual void closed() {}
+    // Called for every string, number or literal, text is set for strings
+    virtual void value(const bool text) = 0;
+
+    uint8_t depth() const { return _depth; }
+    const char *key() const { return _key; }
+    const char *token() const { return _token; }
+    bool isKey(const char *key) const { return strcmp(_key, key) == 0; }
+    // Key of the container at a depth, "" for array elements and the root
+    const char *path(const uint8_t depth) const { return depth < MaxDepth ? _path[depth] : ""; }
+    // Key of the object the current value belongs to
+    const char *parent() const { return _depth > 0 ? path(_depth - 1) : ""; }
+
+private:
+    enum class State : uint8_t
+    {
+        Value,
+        String,
+        Escape,
+        Unicode,
+        Literal
+    };
+
+    void feed(const char c);
+    void open(const bool object);
+    void close();
+    void endString();
+    void endLiteral();
+    void append(const char c);
+    void appendUtf8(const uint16_t code);
+
+    State _state = State::Value;
+    uint8_t _depth = 0;
+    bool _root = false;
+    bool _expectKey = false;
+    uint32_t _objects = 0; // One bit per depth, set for objects
+    char _path[MaxDepth][KeyLength] = {};
+    char _key[KeyLength] = "";
+    char _token[TokenLength] = "";
+    uint16_t _tokenLength = 0;
+    uint16_t _unicode = 0;
+    uint8_t _unicodeDigits = 0;
+};
@@ -0,0 +1,150 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Tracks the GitHub API rate limits reported with every response
+ *              and keeps them across deep sleep for the sleep scheduler.
+ */
+
+#include "RateLimit.h"
+
+#include "time/timeUtils.h"
+
+/**
+ * Read the X-RateLimit-* headers of a response
+ * @param transport Transport after begin() returned
+ */
+void RateLimit::update(const HTTPTransport &transport)
+{
+    const char *limit = transport.header("X-RateLimit-Limit");
+    const char *remaining = transport.header("X-RateLimit-Remaining");
+    const char *reset = transport.header("X-RateLimit-Reset");
+    const char *resource = transport.header("X-RateLimit-Resource");
+
+    if (limit == nullptr || remaining == nullptr || reset == nullptr)
+        return;
+
+    const uint32_t limitValue = strtoul(limit, nullptr, 10);
+    const uint32_t remainingValue = strtoul(remaining, nullptr, 10);
+    const time_t resetValue = (time_t)strtoul(reset, nullptr, 10);
+
+    RateLimitState &entry = state[static_cast<uint8_t>(
+        resource != nullptr && strcmp(resource, "graphql") == 0 ? RateResource::GraphQL : RateResource::Core)];
+
+    portENTER_CRITICAL(&lock);
+    entry.limit = limitValue;
+    entry.remaining = remainingValue;
+    entry.reset = resetValue;
+    if (entry.lastCost == 0)
+        entry.lastCost = 1;
+    portEXIT_CRITICAL(&lock);
+}
+
+/**
+ * Store the rateLimit object of a GraphQL response
+ * @param cost Points the query cost
+ * @param remaining Points left in the current window
+ * @param resetAt ISO 8601 time the window resets
+ */
+void RateLimit::updateGraphQL(const uint16_t cost, const uint32_t remaining, const char *resetAt)
+{
+    RateLimitState &entry = state[static_cast<uint8_t>(RateResource::GraphQL)];
+    const time_t reset = TimeUtils::parseISO8601(resetAt);
+
+    portENTER_CRITICAL(&lock);
+    entry.lastCost = cost > 0 ? cost : 1;
+    entry.remaining = remaining;
+    if (reset != 0)
+        entry.reset = reset;
+    portEXIT_CRITICAL(&lock);
+}
+
+/**
+ * Check whether a resource is running low, so optional requests should be dropped
+ * @param resource Rate limited resource
+ * @param now Current epoch time in seconds
+ */
+bool RateLimit::isLow(const RateResource resource, const time_t now)
+{
+    const RateLimitState entry = read(resource);
+
+    if (entry.limit == 0 || entry.reset <= now)
+        return false;
+
+    return entry.remaining < entry.limit * FetchConfig::RateLimitLow;
+}
+
+/**
+ * Lengthen the sleep interval so the remaining budget of every resource,
+ * minus a reserve for other devices sharing the token, lasts until it resets
+ * @param sleepUs Planned sleep duration in microseconds
+ * @param now Current epoch time in seconds
+ * @return Sleep duration in microseconds, never shorter than planned
+ */
+uint64_t RateLimit::adjustSleep(const uint64_t sleepUs, const time_t now)
+{
+    uint64_t adjusted = sleepUs;
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(RateResource::Count); i++)
+    {
+        const RateLimitState entry = read(static_cast<RateResource>(i));
+
+        if (entry.limit == 0 || entry.reset <= now)
+            continue;
+
+        const uint64_t untilReset = (uint64_t)(entry.reset - now) * 1000000ULL;
+        const int64_t usable = (int64_t)entry.remaining - (int64_t)(entry.limit * FetchConfig::RateLimitReserve);
+        const int64_t wakes = usable / (entry.lastCost > 0 ? entry.lastCost : 1);
+
+        // Wait for the reset when the budget is gone, otherwise spread the rest
+        const uint64_t needed = wakes <= 0 ? untilReset : untilReset / wakes;
+
+        if (needed > adjusted)
+        {
+            Serial.printf("[RateLimit] %s: %lu/%lu left, sleeping %llu s instead of %llu s\n",
+                          name(static_cast<RateResource>(i)), (unsigned long)entry.remaining, (unsigned long)entry.limit,
+                          needed / 1000000ULL, sleepUs / 1000000ULL);
+            adjusted = needed;
+        }
+    }
+
+    // Only the stretch is capped, never the planned interval
+    if (adjusted > sleepUs && adjusted > FetchConfig::RateLimitMaxSleep)
+        adjusted = sleepUs > FetchConfig::RateLimitMaxSleep ? sleepUs : FetchConfig::RateLimitMaxSleep;
+
+    return adjusted;
+}
+
+void RateLimit::print(const time_t now)
+{
+    for (uint8_t i = 0; i < static_cast<uint8_t>(RateResource::Count); i++)
+    {
+        const RateLimitState entry = read(static_cast<RateResource>(i));
+
+        if (entry.limit == 0)
+        {
+            Serial.printf("[Profiler] rate limit %s: unknown\n", name(static_cast<RateResource>(i)));
+            continue;
+        }
+
+        Serial.printf("[Profiler] rate limit %s: %lu/%lu left, last cost %u, reset in %ld s\n",
+                      name(static_cast<RateResource>(i)), (unsigned long)entry.remaining, (unsigned long)entry.limit,
+                      entry.lastCost, (long)(entry.reset > now ? entry.reset - now : 0));
+    }
+}
+
+/**
+ * Copy the state of a resource while no task updates it
+ */
+RateLimitState RateLimit::read(const RateResource resource)
+{
+    portENTER_CRITICAL(&lock);
+    const RateLimitState entry = state[static_cast<uint8_t>(resource)];
+    portEXIT_CRITICAL(&lock);
+    return entry;
+}
+
+const char *RateLimit::name(const RateResource resource)
+{
+    return resource == RateResource::GraphQL ? "graphql" : "core";
+}
@@ -0,0 +1,52 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Tracks the GitHub API rate limits reported with every response
+ *              and keeps them across deep sleep for the sleep scheduler.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+#include <type_traits>
+
+#include "config/fetchConfig.h"
+#include "transport/HTTPTransport.h"
+
+enum class RateResource : uint8_t
+{
+    Core,
+    GraphQL,
+    Count
+};
+
+struct RateLimitState
+{
+    uint32_t limit;
+    uint32_t remaining;
+    time_t reset;
+    uint16_t lastCost;
+};
+
+static_assert(std::is_trivially_default_constructible<RateLimitState>::value,
+              "RateLimitState lives in RTC memory and must not have a constructor");
+
+class RateLimit
+{
+public:
+    static void update(const HTTPTransport &transport);
+    static void updateGraphQL(const uint16_t cost, const uint32_t remaining, const char *resetAt);
+    static bool isLow(const RateResource resource, const time_t now);
+    static uint64_t adjustSleep(const uint64_t sleepUs, const time_t now);
+    static void print(const time_t now);
+
+private:
+    static const char *name(const RateResource resource);
+    static RateLimitState read(const RateResource resource);
+
+    // Responses are received by concurrent executor tasks
+    inline static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    inline static RTC_DATA_ATTR RateLimitState state[static_cast<uint8_t>(RateResource::Count)] = {};
+};
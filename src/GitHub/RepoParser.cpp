@@ -0,0 +1,84 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Streaming parser for one page of the repository scan. Every
+ *              repository is added to the summary as soon as it was received,
+ *              so a page is never held in memory.
+ */
+
+#include "RepoParser.h"
+
+RepoParser::RepoParser(RepoSummary &summary)
+    : _summary(summary)
+{
+}
+
+void RepoParser::opening(const bool object)
+{
+    GraphQLStream::opening(object);
+
+    if (object && depth() == RepoDepth - 1 && strcmp(path(RepoDepth - 2), "nodes") == 0)
+    {
+        _inRepo = true;
+        _repo = {};
+        _forks = 0;
+    }
+}
+
+void RepoParser::closed()
+{
+    if (_inRepo && depth() < RepoDepth)
+    {
+        _summary.add(_repo, _forks);
+        _inRepo = false;
+    }
+}
+
+void RepoParser::dataValue(const bool text)
+{
+    if (!_inRepo)
+    {
+        if (strcmp(parent(), "pageInfo") != 0)
+            return;
+
+        _pageInfo = true;
+        if (isKey("hasNextPage"))
+            _hasNextPage = strcmp(token(), "true") == 0;
+        else if (isKey("endCursor"))
+            strlcpy(_endCursor, text ? token() : "", sizeof(_endCursor));
+        return;
+    }
+
+    if (depth() == RepoDepth)
+    {
+        if (text && isKey("name"))
+            _repo.name = token();
+        else if (text && isKey("description"))
+            _repo.description = token();
+        else if (isKey("stargazerCount"))
+            _repo.stargazers = atoi(token());
+        else if (isKey("forkCount"))
+            _forks = strtoul(token(), nullptr, 10);
+    }
+    else if (isKey("size"))
+    {
+        // Edges list the size before the language it belongs to
+        _languageBytes = strtoul(token(), nullptr, 10);
+    }
+    else if (text && isKey("name"))
+    {
+        if (strcmp(parent(), "primaryLanguage") == 0)
+            _repo.language = token();
+        else if (strcmp(parent(), "node") == 0)
+            _summary.addLanguage(token(), _languageBytes);
+    }
+    else if (text && isKey("spdxId"))
+    {
+        _repo.license = token();
+    }
+    else if (isKey("totalCount") && strcmp(parent(), "watchers") == 0)
+    {
+        _repo.watchers = atoi(token());
+    }
+}
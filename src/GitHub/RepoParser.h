@@ -0,0 +1,47 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Streaming parser for one page of the repository scan. Every
+ *              repository is added to the summary as soon as it was received,
+ *              so a page is never held in memory.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "GraphQLStream.h"
+#include "models/GitHubRepo.h"
+#include "statistics/RepoSummary.h"
+
+class RepoParser : public GraphQLStream
+{
+public:
+    explicit RepoParser(RepoSummary &summary);
+
+    // The whole page was received, false if the user does not exist
+    bool ok() const { return complete() && _pageInfo; }
+    bool hasNextPage() const { return _hasNextPage; }
+    const char *endCursor() const { return _endCursor; }
+
+protected:
+    void opening(const bool object) override;
+    void closed() override;
+    void dataValue(const bool text) override;
+
+private:
+    // Depth of the values of a repository in data.user.repositories.nodes[]
+    static constexpr uint8_t RepoDepth = 6;
+
+    RepoSummary &_summary;
+
+    bool _inRepo = false;
+    GitHubRepo _repo = {};
+    uint32_t _forks = 0;
+    uint32_t _languageBytes = 0;
+
+    bool _pageInfo = false;
+    bool _hasNextPage = false;
+    char _endCursor[64] = "";
+};
@@ -0,0 +1,116 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Runs independent GitHub API requests concurrently in FreeRTOS
+ *              tasks under a shared deadline and heap budget.
+ */
+
+#include "RequestExecutor.h"
+
+RequestExecutor::RequestExecutor(const uint8_t maxParallel)
+    : _maxParallel(maxParallel > 0 ? maxParallel : 1)
+{
+}
+
+/**
+ * Run all jobs, at most maxParallel at a time
+ * A job is only started while enough heap for another TLS connection is free,
+ * otherwise it waits for a running job to finish. Jobs that have not started
+ * when the deadline passes are marked as failed. Running jobs get the
+ * deadline and stop paging once it passed, they are always awaited since
+ * they reference the jobs array.
+ * @param jobs Jobs to run, results are written back into each job
+ * @param count Number of jobs
+ * @param deadlineMs Time budget for all jobs in milliseconds
+ * @return true if every job succeeded
+ */
+bool RequestExecutor::run(FetchJob jobs[], const size_t count, const uint32_t deadlineMs)
+{
+    if (count == 0)
+        return true;
+
+    SemaphoreHandle_t done = xSemaphoreCreateCounting(count, 0);
+    TaskParameter *parameters = new TaskParameter[count];
+
+    const uint32_t start = millis();
+    size_t next = 0;
+    size_t running = 0;
+
+    while (next < count || running > 0)
+    {
+        if (millis() - start >= deadlineMs && next < count)
+        {
+            for (; next < count; next++)
+                Serial.printf("[Executor] %s: not started, deadline passed\n", jobs[next].name);
+        }
+
+        while (next < count && running < _maxParallel && (running == 0 || hasHeap()))
+        {
+            parameters[next] = {&jobs[next], done};
+            jobs[next].started = true;
+            jobs[next].deadline = start + deadlineMs;
+
+            if (xTaskCreate(task, jobs[next].name, Network::RequestTaskStack, &parameters[next], 1, nullptr) == pdPASS)
+                running++;
+            else
+                execute(jobs[next]); // Not enough memory for another task, run it here
+
+            next++;
+        }
+
+        if (running == 0)
+            continue;
+
+        // Wake up at the deadline to drop jobs that could not be started yet
+        const uint32_t elapsed = millis() - start;
+        const TickType_t wait = (next < count && elapsed < deadlineMs) ? pdMS_TO_TICKS(deadlineMs - elapsed) : portMAX_DELAY;
+
+        if (xSemaphoreTake(done, wait) == pdTRUE)
+            running--;
+    }
+
+    const uint32_t wall = millis() - start;
+    uint32_t sequential = 0;
+    bool ok = true;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        sequential += jobs[i].durationMs;
+        ok &= jobs[i].ok;
+        Serial.printf("[Executor] %s: %s in %lu ms\n", jobs[i].name, jobs[i].ok ? "ok" : "failed", (unsigned long)jobs[i].durationMs);
+    }
+    Serial.printf("[Executor] %u jobs in %lu ms (%lu ms sequential)\n", (unsigned)count, (unsigned long)wall, (unsigned long)sequential);
+
+    delete[] parameters;
+    vSemaphoreDelete(done);
+
+    return ok;
+}
+
+void RequestExecutor::task(void *parameter)
+{
+    TaskParameter *taskParameter = static_cast<TaskParameter *>(parameter);
+
+    execute(*taskParameter->job);
+
+    xSemaphoreGive(taskParameter->done);
+    vTaskDelete(nullptr);
+}
+
+void RequestExecutor::execute(FetchJob &job)
+{
+    const uint32_t start = millis();
+    job.ok = job.run(job.context, job.deadline);
+    job.durationMs = millis() - start;
+}
+
+/**
+ * Check whether another TLS connection fits next to the running ones
+ * @return true if the heap budget for one more request is available
+ */
+bool RequestExecutor::hasHeap()
+{
+    return ESP.getFreeHeap() >= Network::RequestHeapBudget &&
+           ESP.getMaxAllocHeap() >= Network::RequestHeapBudget / 2;
+}
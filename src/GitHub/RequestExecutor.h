@@ -0,0 +1,52 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Runs independent GitHub API requests concurrently in FreeRTOS
+ *              tasks under a shared deadline and heap budget.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+#include "config/networkConfig.h"
+
+struct FetchJob
+{
+    const char *name;
+    // Performs the request and stores the parsed model in context. Jobs that
+    // issue several requests stop between them once millis() passed deadline.
+    bool (*run)(void *context, const uint32_t deadline);
+    void *context;
+
+    uint32_t deadline = 0;
+    bool ok = false;
+    bool started = false;
+    uint32_t durationMs = 0;
+};
+
+class RequestExecutor
+{
+public:
+    explicit RequestExecutor(const uint8_t maxParallel = Network::MaxParallelRequests);
+    bool run(FetchJob jobs[], const size_t count, const uint32_t deadlineMs = Network::RequestDeadline);
+
+    // Check a deadline handed to FetchJob::run, safe across the millis() wrap
+    static bool passed(const uint32_t deadline) { return (int32_t)(millis() - deadline) >= 0; }
+
+private:
+    struct TaskParameter
+    {
+        FetchJob *job;
+        SemaphoreHandle_t done;
+    };
+
+    static void task(void *parameter);
+    static void execute(FetchJob &job);
+    static bool hasHeap();
+
+    uint8_t _maxParallel;
+};
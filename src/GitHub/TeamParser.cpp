@@ -0,0 +1,110 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Streaming parser for the team GraphQL response. Every aliased
+ *              user is written straight into its own TeamMember while the
+ *              body arrives.
+ */
+
+#include "TeamParser.h"
+
+/**
+ * @param members Receive the users aliased u0 to u<count - 1>, must be zeroed
+ * @param count Number of members
+ */
+TeamParser::TeamParser(TeamMember *members, const uint8_t count)
+    : _members(members), _count(count)
+{
+}
+
+/**
+ * Aliased users are the objects u0, u1, ... inside data
+ */
+void TeamParser::opening(const bool object)
+{
+    GraphQLStream::opening(object);
+
+    if (object && _user < 0 && depth() == 2 && strcmp(path(1), "data") == 0 &&
+        key()[0] == 'u' && isdigit((unsigned char)key()[1]))
+    {
+        const int user = atoi(key() + 1);
+        if (user < _count)
+        {
+            _user = user;
+            _userDepth = depth() + 1;
+            _index = 0;
+            _days = 0;
+        }
+    }
+}
+
+void TeamParser::closed()
+{
+    if (_user >= 0 && depth() < _userDepth)
+    {
+        _members[_user].valid = _days > 0;
+        _user = -1;
+    }
+}
+
+void TeamParser::dataValue(const bool text)
+{
+    if (_user < 0)
+        return;
+
+    TeamMember &member = _members[_user];
+
+    if (isKey("contributionCount"))
+    {
+        const uint32_t count = strtoul(token(), nullptr, 10);
+        if (_index >= 0 && _index < (int32_t)(sizeof(GitHubStats::commits) / sizeof(GitHubStats::commits[0])))
+            member.stats.commits[_index] = count > UINT16_MAX ? UINT16_MAX : count;
+        _index++;
+        _days++;
+    }
+    else if (isKey("firstDay"))
+    {
+        // The first week may start mid week, the calendar starts on the Sunday before
+        const int32_t day = TimeUtils::parseDate(token());
+        if (_days == 0)
+        {
+            member.stats.startDay = day - TimeUtils::weekdayFromDays(day);
+            member.stats.firstDay = day;
+        }
+        _index = day - member.stats.startDay;
+    }
+    else if (isKey("totalContributions"))
+    {
+        member.stats.contributions = atoi(token());
+    }
+    else if (isKey("totalCount"))
+    {
+        const char *counted = parent();
+        if (strcmp(counted, "followers") == 0)
+            member.profile.followers = atoi(token());
+        else if (strcmp(counted, "following") == 0)
+            member.profile.following = atoi(token());
+        else if (strcmp(counted, "gists") == 0)
+            member.profile.publicGists = atoi(token());
+        else if (strcmp(counted, "repositories") == 0)
+            member.profile.publicRepos = atoi(token());
+    }
+    else if (text && depth() == _userDepth)
+    {
+        if (isKey("login"))
+            member.profile.username = token();
+        else if (isKey("name"))
+            member.profile.name = token();
+        else if (isKey("bio"))
+            member.profile.bio = token();
+        else if (isKey("company"))
+            member.profile.company = token();
+        else if (isKey("email"))
+            member.profile.email = token();
+        else if (isKey("websiteUrl"))
+            member.profile.blog = token();
+        else if (isKey("twitterUsername"))
+            member.profile.twitterUsername = token();
+    }
+}
@@ -0,0 +1,39 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Streaming parser for the team GraphQL response. Every aliased
+ *              user is written straight into its own TeamMember while the
+ *              body arrives.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "GraphQLStream.h"
+#include "models/TeamMember.h"
+#include "time/timeUtils.h"
+
+class TeamParser : public GraphQLStream
+{
+public:
+    TeamParser(TeamMember *members, const uint8_t count);
+
+    // The whole document was received, users missing from it are not valid
+    bool ok() const { return complete(); }
+
+protected:
+    void opening(const bool object) override;
+    void closed() override;
+    void dataValue(const bool text) override;
+
+private:
+    TeamMember *_members;
+    uint8_t _count;
+
+    int8_t _user = -1;
+    uint8_t _userDepth = 0;
+    int32_t _index = 0; // Position of the next day in the calendar
+    uint16_t _days = 0; // Days received of the current user
+};
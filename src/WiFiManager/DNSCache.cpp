@@ -0,0 +1,159 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Caches resolved host addresses in RTC memory so a wake can
+ *              connect without waiting for DNS. Expired entries are still used
+ *              and refreshed in the background until a refresh succeeds.
+ */
+
+#include "DNSCache.h"
+
+/**
+ * Resolve a host, preferring the cached address
+ * An expired entry is returned as well and a background task re-resolves it
+ * for the next wake. Only a missing entry blocks on a DNS query.
+ * @param host Host name to resolve
+ * @param ip Resolved address
+ * @return false if the host could not be resolved
+ */
+bool DNSCache::resolve(const char *host, IPAddress &ip)
+{
+    const time_t now = time(nullptr);
+
+    portENTER_CRITICAL(&lock);
+    DNSEntry *entry = find(host);
+    const bool cached = entry != nullptr;
+    const uint8_t bit = cached ? 1 << (entry - entries) : 0;
+    // The expiry only moves once the refresh stored a new address, so a
+    // refresh cut off by deep sleep is retried on the next wake
+    const bool refresh = cached && entry->expires <= now && (refreshing & bit) == 0;
+    if (cached)
+    {
+        ip = IPAddress(entry->ip);
+        hits++;
+        savedMs += averageResolveMs;
+    }
+    else
+    {
+        misses++;
+    }
+    if (refresh)
+        refreshing |= bit;
+    portEXIT_CRITICAL(&lock);
+
+    if (refresh && xTaskCreate(refreshTask, "dnsRefresh", 3072, entry, 1, nullptr) != pdPASS)
+    {
+        // No memory for the task, let a later call try again
+        portENTER_CRITICAL(&lock);
+        refreshing &= ~bit;
+        portEXIT_CRITICAL(&lock);
+    }
+
+    return cached || lookup(host, ip);
+}
+
+/**
+ * Forget a cached address, e.g. after connecting to it failed
+ * @param host Host name to remove
+ */
+void DNSCache::invalidate(const char *host)
+{
+    portENTER_CRITICAL(&lock);
+    DNSEntry *entry = find(host);
+    if (entry != nullptr)
+        entry->host[0] = '\0';
+    portEXIT_CRITICAL(&lock);
+}
+
+void DNSCache::print()
+{
+    portENTER_CRITICAL(&lock);
+    const uint32_t hitCount = hits;
+    const uint32_t missCount = misses;
+    const uint32_t saved = savedMs;
+    portEXIT_CRITICAL(&lock);
+
+    Serial.printf("[Profiler] dns cache: %lu hits, %lu misses, ~%lu ms saved\n",
+                  (unsigned long)hitCount, (unsigned long)missCount, (unsigned long)saved);
+}
+
+DNSEntry *DNSCache::find(const char *host)
+{
+    for (uint8_t i = 0; i < MaxEntries; i++)
+    {
+        if (entries[i].host[0] != '\0' && strcmp(entries[i].host, host) == 0)
+            return &entries[i];
+    }
+    return nullptr;
+}
+
+/**
+ * Resolve a host with a blocking DNS query and cache the result
+ */
+bool DNSCache::lookup(const char *host, IPAddress &ip)
+{
+    const uint32_t start = millis();
+
+    if (!WiFi.hostByName(host, ip))
+    {
+        Serial.printf("[DNS] Unable to resolve %s\n", host);
+        return false;
+    }
+
+    const uint32_t duration = millis() - start;
+    portENTER_CRITICAL(&lock);
+    averageResolveMs = averageResolveMs == 0 ? duration : (averageResolveMs * 3 + duration) / 4;
+    portEXIT_CRITICAL(&lock);
+
+    store(host, ip);
+    return true;
+}
+
+void DNSCache::store(const char *host, const IPAddress &ip)
+{
+    if (strlen(host) >= sizeof(DNSEntry::host))
+        return;
+
+    const time_t expires = time(nullptr) + Network::DnsTTL;
+
+    portENTER_CRITICAL(&lock);
+    DNSEntry *entry = find(host);
+
+    // Reuse a free slot, or replace the entry that expires first
+    for (uint8_t i = 0; entry == nullptr && i < MaxEntries; i++)
+    {
+        if (entries[i].host[0] == '\0')
+            entry = &entries[i];
+    }
+    if (entry == nullptr)
+    {
+        entry = &entries[0];
+        for (uint8_t i = 1; i < MaxEntries; i++)
+        {
+            if (entries[i].expires < entry->expires)
+                entry = &entries[i];
+        }
+    }
+
+    strlcpy(entry->host, host, sizeof(entry->host));
+    entry->ip = (uint32_t)ip;
+    entry->expires = expires;
+    portEXIT_CRITICAL(&lock);
+}
+
+void DNSCache::refreshTask(void *parameter)
+{
+    DNSEntry *entry = static_cast<DNSEntry *>(parameter);
+    char host[sizeof(DNSEntry::host)];
+    IPAddress ip;
+
+    portENTER_CRITICAL(&lock);
+    strlcpy(host, entry->host, sizeof(host));
+    portEXIT_CRITICAL(&lock);
+
+    if (host[0] != '\0')
+        lookup(host, ip);
+
+    vTaskDelete(nullptr);
+}
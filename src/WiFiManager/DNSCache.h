@@ -0,0 +1,53 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Caches resolved host addresses in RTC memory so a wake can
+ *              connect without waiting for DNS. Expired entries are still used
+ *              and refreshed in the background until a refresh succeeds.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <time.h>
+#include <type_traits>
+
+#include "config/networkConfig.h"
+
+struct DNSEntry
+{
+    char host[32];
+    uint32_t ip;
+    time_t expires;
+};
+
+static_assert(std::is_trivially_default_constructible<DNSEntry>::value,
+              "DNSEntry lives in RTC memory and must not have a constructor");
+
+class DNSCache
+{
+public:
+    static bool resolve(const char *host, IPAddress &ip);
+    static void invalidate(const char *host);
+    static void print();
+
+private:
+    static constexpr uint8_t MaxEntries = 4;
+
+    static DNSEntry *find(const char *host);
+    static bool lookup(const char *host, IPAddress &ip);
+    static void store(const char *host, const IPAddress &ip);
+    static void refreshTask(void *parameter);
+
+    inline static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    // Entries with a refresh running in this wake, one bit per entry
+    inline static uint8_t refreshing = 0;
+
+    inline static RTC_DATA_ATTR DNSEntry entries[MaxEntries] = {};
+    inline static RTC_DATA_ATTR uint32_t hits = 0;
+    inline static RTC_DATA_ATTR uint32_t misses = 0;
+    inline static RTC_DATA_ATTR uint32_t savedMs = 0;
+    inline static RTC_DATA_ATTR uint32_t averageResolveMs = 0;
+};
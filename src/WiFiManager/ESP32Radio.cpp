@@ -0,0 +1,116 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: WiFi driver of the ESP32 on top of the Arduino WiFi class
+ */
+
+#ifdef ARDUINO
+
+#include "ESP32Radio.h"
+
+void ESP32Radio::start(const char *hostname, EventHandler eventHandler)
+{
+    WiFi.setHostname(hostname);
+    WiFi.mode(WIFI_STA);
+
+    if (handler == nullptr)
+        WiFi.onEvent(onEvent);
+    handler = eventHandler;
+}
+
+void ESP32Radio::begin(const char *ssid, const char *password, const int32_t channel, const uint8_t *bssid,
+                       const WiFiConnection *address)
+{
+    if (address != nullptr)
+        WiFi.config(IPAddress(address->ip), IPAddress(address->gateway), IPAddress(address->subnet), IPAddress(address->dns));
+    else
+        WiFi.config(IPAddress((uint32_t)0), IPAddress((uint32_t)0), IPAddress((uint32_t)0));
+
+    if (channel != 0 || bssid != nullptr)
+        WiFi.begin(ssid, password, channel, bssid, true);
+    else
+        WiFi.begin(ssid, password);
+}
+
+void ESP32Radio::disconnect()
+{
+    WiFi.disconnect();
+}
+
+void ESP32Radio::off()
+{
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+}
+
+int16_t ESP32Radio::scan()
+{
+    _found = WiFi.scanNetworks();
+    return _found;
+}
+
+bool ESP32Radio::scanResult(const int16_t index, WiFiScanResult &result) const
+{
+    if (index < 0 || index >= _found)
+        return false;
+
+    strlcpy(result.ssid, WiFi.SSID(index).c_str(), sizeof(result.ssid));
+    result.rssi = WiFi.RSSI(index);
+    result.channel = WiFi.channel(index);
+    memcpy(result.bssid, WiFi.BSSID(index), sizeof(result.bssid));
+    return true;
+}
+
+void ESP32Radio::endScan()
+{
+    WiFi.scanDelete();
+    _found = 0;
+}
+
+void ESP32Radio::connection(WiFiConnection &connection) const
+{
+    connection.channel = WiFi.channel();
+    memcpy(connection.bssid, WiFi.BSSID(), sizeof(connection.bssid));
+    connection.ip = WiFi.localIP();
+    connection.gateway = WiFi.gatewayIP();
+    connection.subnet = WiFi.subnetMask();
+    connection.dns = WiFi.dnsIP();
+}
+
+int8_t ESP32Radio::rssi() const
+{
+    return WiFi.RSSI();
+}
+
+void ESP32Radio::printInformation() const
+{
+    Serial.print("Connected to ");
+    Serial.println(WiFi.SSID());
+    Serial.print("Connected as ");
+    Serial.println(WiFi.getHostname());
+    Serial.print("Local IP: ");
+    Serial.println(WiFi.localIP());
+    Serial.print("MAC-Address: ");
+    Serial.println(WiFi.macAddress());
+}
+
+void ESP32Radio::onEvent(WiFiEvent_t event, WiFiEventInfo_t info)
+{
+    if (handler == nullptr)
+        return;
+
+    switch (event)
+    {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+        handler(Event::GotIP);
+        break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+        handler(Event::Disconnected);
+        break;
+    default:
+        break;
+    }
+}
+
+#endif
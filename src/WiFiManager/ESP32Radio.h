@@ -0,0 +1,39 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: WiFi driver of the ESP32 on top of the Arduino WiFi class
+ */
+
+#pragma once
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include "WiFiRadio.h"
+
+class ESP32Radio : public WiFiRadio
+{
+public:
+    void start(const char *hostname, EventHandler handler) override;
+    void begin(const char *ssid, const char *password, const int32_t channel, const uint8_t *bssid,
+               const WiFiConnection *address) override;
+    void disconnect() override;
+    void off() override;
+    int16_t scan() override;
+    bool scanResult(const int16_t index, WiFiScanResult &result) const override;
+    void endScan() override;
+    void connection(WiFiConnection &connection) const override;
+    int8_t rssi() const override;
+    void printInformation() const override;
+
+private:
+    static void onEvent(WiFiEvent_t event, WiFiEventInfo_t info);
+
+    inline static EventHandler handler = nullptr;
+    int16_t _found = 0;
+};
+
+#endif
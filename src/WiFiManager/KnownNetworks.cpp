@@ -0,0 +1,137 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: List of known WiFi networks stored in NVS, seeded from the
+ *              credentials on first use.
+ */
+
+#include "KnownNetworks.h"
+
+static constexpr char Namespace[] = "wifi";
+
+/**
+ * Read all known networks from NVS and add the ones from credentials.h
+ * Empty slots are dropped. The compacted list is written back right away,
+ * so that the NVS keys keep matching the indices used by add().
+ */
+void KnownNetworks::load()
+{
+    Preferences preferences;
+    _count = 0;
+    uint8_t stored = 0;
+
+    if (preferences.begin(Namespace, true))
+    {
+        stored = preferences.getUChar("count", 0);
+        if (stored > MaxNetworks)
+            stored = MaxNetworks;
+
+        for (uint8_t i = 0; i < stored; i++)
+        {
+            KnownNetwork &network = _networks[_count];
+            network.ssid[0] = '\0';
+            network.password[0] = '\0';
+
+            char key[8];
+            snprintf(key, sizeof(key), "ssid%u", i);
+            preferences.getString(key, network.ssid, sizeof(KnownNetwork::ssid));
+            snprintf(key, sizeof(key), "pass%u", i);
+            preferences.getString(key, network.password, sizeof(KnownNetwork::password));
+
+            if (network.ssid[0] != '\0')
+                _count++;
+        }
+
+        preferences.end();
+    }
+
+    if (_count < stored)
+        save(stored);
+
+    seed();
+}
+
+/**
+ * Rewrite the whole list under the keys of its current indices
+ * @param stored Number of slots in NVS before, the ones past the list are removed
+ */
+void KnownNetworks::save(const uint8_t stored)
+{
+    Preferences preferences;
+    if (!preferences.begin(Namespace, false))
+        return;
+
+    char key[8];
+    for (uint8_t i = 0; i < stored; i++)
+    {
+        snprintf(key, sizeof(key), "ssid%u", i);
+        if (i < _count)
+            preferences.putString(key, _networks[i].ssid);
+        else
+            preferences.remove(key);
+
+        snprintf(key, sizeof(key), "pass%u", i);
+        if (i < _count)
+            preferences.putString(key, _networks[i].password);
+        else
+            preferences.remove(key);
+    }
+
+    preferences.putUChar("count", _count);
+    preferences.end();
+}
+
+/**
+ * Add a network or update its password, NVS is only written on changes
+ * @param ssid Network name
+ * @param password Network password
+ * @return false if the list is full
+ */
+bool KnownNetworks::add(const char *ssid, const char *password)
+{
+    uint8_t index = 0;
+    while (index < _count && strcmp(_networks[index].ssid, ssid) != 0)
+        index++;
+
+    if (index < _count && strcmp(_networks[index].password, password) == 0)
+        return true;
+
+    if (index == MaxNetworks)
+        return false;
+
+    strlcpy(_networks[index].ssid, ssid, sizeof(KnownNetwork::ssid));
+    strlcpy(_networks[index].password, password, sizeof(KnownNetwork::password));
+    if (index == _count)
+        _count++;
+
+    Preferences preferences;
+    if (!preferences.begin(Namespace, false))
+        return false;
+
+    char key[8];
+    snprintf(key, sizeof(key), "ssid%u", index);
+    preferences.putString(key, _networks[index].ssid);
+    snprintf(key, sizeof(key), "pass%u", index);
+    preferences.putString(key, _networks[index].password);
+    preferences.putUChar("count", _count);
+    preferences.end();
+
+    return true;
+}
+
+/**
+ * Make sure the networks from credentials.h are known
+ * Additional networks can be configured with WIFI_SSID_2/WIFI_PASSWORD_2
+ * and WIFI_SSID_3/WIFI_PASSWORD_3.
+ */
+void KnownNetworks::seed()
+{
+    add(WIFI_SSID, WIFI_PASSWORD);
+#if defined(WIFI_SSID_2) && defined(WIFI_PASSWORD_2)
+    add(WIFI_SSID_2, WIFI_PASSWORD_2);
+#endif
+#if defined(WIFI_SSID_3) && defined(WIFI_PASSWORD_3)
+    add(WIFI_SSID_3, WIFI_PASSWORD_3);
+#endif
+}
@@ -0,0 +1,38 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: List of known WiFi networks stored in NVS, seeded from the
+ *              credentials on first use.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+#include "resources/credentials.h"
+
+struct KnownNetwork
+{
+    char ssid[33];
+    char password[65];
+};
+
+class KnownNetworks
+{
+public:
+    static constexpr uint8_t MaxNetworks = 4;
+
+    void load();
+    bool add(const char *ssid, const char *password);
+    uint8_t count() const { return _count; }
+    const KnownNetwork &operator[](const uint8_t index) const { return _networks[index]; }
+
+private:
+    void seed();
+    void save(const uint8_t stored);
+
+    KnownNetwork _networks[MaxNetworks];
+    uint8_t _count = 0;
+};
@@ -2,19 +2,20 @@
  * Created on: 2026-07-26
  * Author(s): Toni Fey
  * License: MIT
- * Description:
+ * Description: Event driven WiFi connection with a cached fast path and
+ *              RSSI ranked selection between several known networks
  */
 
 #include "WiFiManager.h"
 
 int8_t WiFiManager::RSSI()
 {
-    return WiFi.RSSI();
+    return _radio.rssi();
 }
 
 const char *WiFiManager::getWiFidesc()
 {
-    int8_t rssi = WiFi.RSSI();
+    int8_t rssi = _radio.rssi();
     if (rssi == 0)
     {
         return getStrings().noConnection;
@@ -41,66 +42,281 @@ inline void WiFiManager::printWiFiInformation()
 {
     Serial.println("--------------------------------");
     Serial.println();
-    Serial.print("Connected to ");
-    Serial.println(WiFi.SSID());
-    Serial.print("Connected as ");
-    Serial.println(WiFi.getHostname());
-    Serial.print("Local IP: ");
-    Serial.println(WiFi.localIP());
-    Serial.print("MAC-Address: ");
-    Serial.println(WiFi.macAddress());
-    Serial.print("Connection Strength: ");
-    Serial.print(getWiFidesc());
-    Serial.print(" (");
-    Serial.print(WiFi.RSSI());
-    Serial.println(" dBm)");
+    _radio.printInformation();
+    Serial.printf("Connection Strength: %s (%d dBm)\n", getWiFidesc(), _radio.rssi());
     Serial.println();
     Serial.println("--------------------------------");
 }
 
+/**
+ * Connect to the best known network
+ * Tries the cached connection of the last wake first, then the known
+ * networks in the order of the last scan. Only when none of them works, or
+ * nothing was scanned yet, a new scan ranks the networks again.
+ * @return true once an IP address was assigned
+ */
 bool WiFiManager::init()
 {
-    return init(WIFI_SSID, WIFI_PASSWORD);
+    prepare();
+
+    KnownNetworks networks;
+    networks.load();
+
+    if (networks.count() == 0)
+        return false;
+
+    if (hasStoredConnection() && storedNetwork < networks.count())
+    {
+        if (connectFast(networks[storedNetwork].ssid, networks[storedNetwork].password))
+            return true;
+
+        forgetConnection();
+    }
+
+    bool scanned = false;
+    if (candidateCount == 0)
+    {
+        scan(networks);
+        scanned = true;
+    }
+
+    if (connectCandidates(networks))
+        return true;
+
+    if (scanned)
+        return false;
+
+    scan(networks);
+    return connectCandidates(networks);
 }
 
-bool WiFiManager::init(const char *SSID, const char *PASSWORD)
+void WiFiManager::handleEvent(const WiFiRadio::Event event)
 {
-    WiFi.setHostname(Network::Hostname);
+    if (events == nullptr)
+        return;
 
-    if (storedChannel != 0 && storedIP != 0)
+    switch (event)
     {
-        WiFi.config(IPAddress(storedIP), IPAddress(storedGateway), IPAddress(storedSubnet), IPAddress(storedDNS));
-        WiFi.begin(SSID, PASSWORD, storedChannel, storedBSSID, true);
+    case WiFiRadio::Event::GotIP:
+        xEventGroupSetBits(events, ConnectedBit);
+        break;
+    case WiFiRadio::Event::Disconnected:
+        xEventGroupSetBits(events, FailedBit | DisconnectedBit);
+        break;
     }
-    else
-        WiFi.begin(SSID, PASSWORD);
+}
+
+/**
+ * Turn the radio off and lower the CPU clock once all network results are in
+ * Rendering and the panel refresh take seconds and need neither.
+ */
+void WiFiManager::shutdown()
+{
+    if (radioOnSince == 0)
+        return;
 
+    _radio.off();
+    setCpuFrequencyMhz(Network::RadioOffCpuFrequency);
+
+    radioOnMs = millis() - radioOnSince;
+    radioOnSince = 0;
+    radioOnTotalMs += radioOnMs;
+    radioWakes++;
+}
+
+/**
+ * Time the radio was on during this wake
+ * @return Milliseconds, counted up to now while the radio is still on
+ */
+uint32_t WiFiManager::radioOnTime()
+{
+    return radioOnSince != 0 ? millis() - radioOnSince : radioOnMs;
+}
+
+void WiFiManager::printTiming()
+{
+    Serial.printf("[Profiler] wifi: fast path %lu ms, full path %lu ms (%lu fast, %lu fallbacks)\n",
+                  (unsigned long)fastPathMs, (unsigned long)fullPathMs,
+                  (unsigned long)fastPathCount, (unsigned long)fallbackCount);
+
+    if (radioWakes > 0)
+    {
+        Serial.printf("[Profiler] radio on %lu ms (average %lu ms over %lu wakes)\n",
+                      (unsigned long)radioOnMs, (unsigned long)(radioOnTotalMs / radioWakes),
+                      (unsigned long)radioWakes);
+    }
+}
+
+void WiFiManager::prepare()
+{
+    if (radioOnSince == 0)
+        radioOnSince = millis();
+
+    if (events == nullptr)
+        events = xEventGroupCreate();
+
+    _radio.start(Network::Hostname, handleEvent);
+}
+
+/**
+ * Reconnect with the cached BSSID, channel and static IP
+ * Gives up early when the access point rejects or cannot be found.
+ */
+bool WiFiManager::connectFast(const char *SSID, const char *PASSWORD)
+{
     Timer timer;
     timer.begin();
 
-    while (WiFi.status() != WL_CONNECTED)
+    xEventGroupClearBits(events, ConnectedBit | FailedBit);
+    _radio.begin(SSID, PASSWORD, stored.channel, stored.bssid, &stored);
+
+    const bool connected = waitForConnection(Network::FastPathTimeout, true);
+    fastPathMs = timer.elapsed();
+
+    if (connected)
     {
-        Serial.print(".");
-        delay(200);
+        fastPathCount++;
+        Serial.printf("[WiFi] Connected through the fast path in %lu ms\n", (unsigned long)fastPathMs);
+    }
+    else
+    {
+        fallbackCount++;
+        Serial.printf("[WiFi] Fast path failed after %lu ms\n", (unsigned long)fastPathMs);
+    }
 
-        if (timer.elapsed() >= Network::Timeout)
+    return connected;
+}
+
+/**
+ * Block until the connection event arrives
+ * @param timeout Maximum time to wait in milliseconds
+ * @param failFast Return as soon as a disconnect event arrives
+ */
+bool WiFiManager::waitForConnection(const uint32_t timeout, const bool failFast)
+{
+    const EventBits_t waitFor = failFast ? (ConnectedBit | FailedBit) : ConnectedBit;
+    const EventBits_t bits = xEventGroupWaitBits(events, waitFor, pdFALSE, pdFALSE, pdMS_TO_TICKS(timeout));
+
+    return bits & ConnectedBit;
+}
+
+/**
+ * Try the ranked candidates one after another, each with DHCP and the full
+ * timeout. Only the stored fast path fails fast, a slow DHCP server or a
+ * single dropped association must not fail every candidate.
+ * @param networks Known networks the candidates refer to
+ */
+bool WiFiManager::connectCandidates(const KnownNetworks &networks)
+{
+    for (uint8_t i = 0; i < candidateCount; i++)
+    {
+        const NetworkCandidate &candidate = candidates[i];
+        if (candidate.network >= networks.count())
+            continue;
+
+        const KnownNetwork &network = networks[candidate.network];
+
+        Timer timer;
+        timer.begin();
+
+        xEventGroupClearBits(events, ConnectedBit | FailedBit);
+        _radio.begin(network.ssid, network.password, candidate.channel, candidate.bssid, nullptr);
+
+        // Disconnects while associating are retried by the driver, only wait for the address
+        if (waitForConnection(Network::Timeout, false))
         {
-            return false;
+            fullPathMs = timer.elapsed();
+            Serial.printf("[WiFi] Connected to %s (%d dBm at last scan) in %lu ms\n",
+                          network.ssid, candidate.rssi, (unsigned long)fullPathMs);
+            storedNetwork = candidate.network;
+            storeConnection();
+            return true;
         }
+
+        Serial.printf("[WiFi] %s not reachable, trying the next network\n", network.ssid);
+        disconnect();
     }
-    Serial.println();
 
-    if (storedIP == 0)
+    return false;
+}
+
+/**
+ * Scan once and rank the known networks by the RSSI of their strongest
+ * access point, the result is kept in RTC memory for the next wakes
+ * @param networks Known networks to look for
+ */
+void WiFiManager::scan(const KnownNetworks &networks)
+{
+    Timer timer;
+    timer.begin();
+
+    candidateCount = 0;
+    const int16_t found = _radio.scan();
+
+    for (uint8_t n = 0; n < networks.count(); n++)
     {
-        storedChannel = WiFi.channel();
-        memcpy(storedBSSID, WiFi.BSSID(), 6);
-        storedIP = WiFi.localIP();
-        storedGateway = WiFi.gatewayIP();
-        storedSubnet = WiFi.subnetMask();
-        storedDNS = WiFi.dnsIP();
+        WiFiScanResult best = {};
+        bool seen = false;
+        for (int16_t i = 0; i < found; i++)
+        {
+            WiFiScanResult result;
+            if (_radio.scanResult(i, result) && strcmp(result.ssid, networks[n].ssid) == 0 &&
+                (!seen || result.rssi > best.rssi))
+            {
+                best = result;
+                seen = true;
+            }
+        }
+
+        if (!seen)
+            continue;
+
+        // Insert sorted by RSSI, strongest first
+        NetworkCandidate candidate = {n, best.rssi, {0}, best.channel};
+        memcpy(candidate.bssid, best.bssid, 6);
+
+        uint8_t position = candidateCount;
+        while (position > 0 && candidates[position - 1].rssi < candidate.rssi)
+        {
+            candidates[position] = candidates[position - 1];
+            position--;
+        }
+        candidates[position] = candidate;
+        candidateCount++;
     }
 
-    delay(10);
-    
-    return true;
-}
\ No newline at end of file
+    _radio.endScan();
+    Serial.printf("[WiFi] Scan found %u of %u known networks in %lu ms\n",
+                  candidateCount, networks.count(), (unsigned long)timer.elapsed());
+}
+
+void WiFiManager::forgetConnection()
+{
+    // The access point or the network changed, forget the cached details
+    stored.channel = 0;
+    stored.ip = 0;
+    disconnect();
+}
+
+/**
+ * Drop the current attempt and wait for the driver to report it
+ * The Disconnected event is delivered asynchronously. Without waiting it can
+ * arrive after the bits were cleared for the next attempt, which would then
+ * fail fast without ever trying.
+ */
+void WiFiManager::disconnect()
+{
+    xEventGroupClearBits(events, DisconnectedBit);
+    _radio.disconnect();
+    xEventGroupWaitBits(events, DisconnectedBit, pdTRUE, pdFALSE, pdMS_TO_TICKS(Network::DisconnectTimeout));
+}
+
+void WiFiManager::storeConnection()
+{
+    _radio.connection(stored);
+}
+
+bool WiFiManager::hasStoredConnection()
+{
+    return stored.channel != 0 && stored.ip != 0;
+}
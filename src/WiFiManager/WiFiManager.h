@@ -2,37 +2,82 @@
  * Created on: 2026-07-26
  * Author(s): Toni Fey
  * License: MIT
- * Description:
+ * Description: Event driven WiFi connection with a cached fast path and
+ *              RSSI ranked selection between several known networks
  */
 
 #pragma once
 
 #include <Arduino.h>
-#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
 
 #include "i18n/i18n.h"
 #include "config/networkConfig.h"
 #include "resources/credentials.h"
 #include "timer/timer.h"
+#include "KnownNetworks.h"
+#include "WiFiRadio.h"
+
+// Strongest access point of a known network found by the last scan
+struct NetworkCandidate
+{
+    uint8_t network;
+    int8_t rssi;
+    uint8_t bssid[6];
+    int32_t channel;
+};
 
 class WiFiManager
 {
 
 public:
+    explicit WiFiManager(WiFiRadio &radio) : _radio(radio) {}
+
     bool init();
-    bool init(const char *SSID, const char *PASSWORD);
     const char *getWiFidesc();
     inline void printWiFiInformation();
     int8_t RSSI();
+    void shutdown();
+    static uint32_t radioOnTime();
+    static void printTiming();
 
 private:
+    static constexpr EventBits_t ConnectedBit = BIT0;
+    static constexpr EventBits_t FailedBit = BIT1;
+    static constexpr EventBits_t DisconnectedBit = BIT2;
+
+    static void handleEvent(const WiFiRadio::Event event);
+
+    void prepare();
+    bool connectFast(const char *SSID, const char *PASSWORD);
+    bool connectCandidates(const KnownNetworks &networks);
+    void scan(const KnownNetworks &networks);
+    void forgetConnection();
+    void disconnect();
+    bool waitForConnection(const uint32_t timeout, const bool failFast);
+    void storeConnection();
+    static bool hasStoredConnection();
+
+    WiFiRadio &_radio;
+
+    inline static EventGroupHandle_t events = nullptr;
+    inline static uint32_t fastPathMs = 0;
+    inline static uint32_t fullPathMs = 0;
+    inline static uint32_t radioOnSince = 0;
+    inline static uint32_t radioOnMs = 0;
+
     // RTC_DATA_ATTR is a section attribute and cannot be applied to non-static
     // class members. Use inline static so these have static storage and can
     // safely be placed in RTC memory when the attribute is supported.
-    inline static RTC_DATA_ATTR uint8_t storedBSSID[6] = {0};
-    inline static RTC_DATA_ATTR int32_t storedChannel = 0;
-    inline static RTC_DATA_ATTR uint32_t storedIP = 0;
-    inline static RTC_DATA_ATTR uint32_t storedGateway = 0;
-    inline static RTC_DATA_ATTR uint32_t storedSubnet = 0;
-    inline static RTC_DATA_ATTR uint32_t storedDNS = 0;
-};
\ No newline at end of file
+    inline static RTC_DATA_ATTR WiFiConnection stored = {};
+    inline static RTC_DATA_ATTR uint8_t storedNetwork = 0;
+
+    // Known networks ranked by RSSI, strongest first
+    inline static RTC_DATA_ATTR NetworkCandidate candidates[KnownNetworks::MaxNetworks] = {};
+    inline static RTC_DATA_ATTR uint8_t candidateCount = 0;
+    inline static RTC_DATA_ATTR uint32_t fastPathCount = 0;
+    inline static RTC_DATA_ATTR uint32_t fallbackCount = 0;
+    inline static RTC_DATA_ATTR uint32_t radioOnTotalMs = 0;
+    inline static RTC_DATA_ATTR uint32_t radioWakes = 0;
+};
@@ -0,0 +1,75 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Interface of the WiFi driver used by WiFiManager. The ESP32
+ *              implementation wraps the Arduino WiFi class, a simulated one
+ *              drives the connection paths in the native tests.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <type_traits>
+
+// Details of an established connection, reused by the fast path
+struct WiFiConnection
+{
+    int32_t channel;
+    uint8_t bssid[6];
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+};
+
+static_assert(std::is_trivially_default_constructible<WiFiConnection>::value,
+              "WiFiConnection lives in RTC memory and must not have a constructor");
+
+struct WiFiScanResult
+{
+    char ssid[33];
+    int8_t rssi;
+    int32_t channel;
+    uint8_t bssid[6];
+};
+
+class WiFiRadio
+{
+public:
+    enum class Event : uint8_t
+    {
+        GotIP,
+        Disconnected
+    };
+
+    // Called from the event task of the driver
+    using EventHandler = void (*)(const Event event);
+
+    virtual ~WiFiRadio() = default;
+
+    // Switch to station mode, events are delivered to handler from now on
+    virtual void start(const char *hostname, EventHandler handler) = 0;
+
+    /**
+     * Start connecting, the result arrives as an event
+     * @param channel Channel of the access point, 0 to scan for it
+     * @param bssid Access point to use, nullptr for any
+     * @param address Static address, nullptr for DHCP
+     */
+    virtual void begin(const char *ssid, const char *password, const int32_t channel, const uint8_t *bssid,
+                       const WiFiConnection *address) = 0;
+
+    // Drop the connection or the attempt, a Disconnected event follows
+    virtual void disconnect() = 0;
+    virtual void off() = 0;
+
+    // Blocking scan, results stay available until endScan()
+    virtual int16_t scan() = 0;
+    virtual bool scanResult(const int16_t index, WiFiScanResult &result) const = 0;
+    virtual void endScan() = 0;
+
+    virtual void connection(WiFiConnection &connection) const = 0;
+    virtual int8_t rssi() const = 0;
+    virtual void printInformation() const {}
+};
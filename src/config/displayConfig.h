@@ -24,4 +24,12 @@ namespace DisplayConfig
 
     constexpr uint16_t Width = 800;
     constexpr uint16_t Height = 480;
+
+    // Light sleep while the panel refreshes instead of polling the busy pin
+    constexpr bool LightSleepWhileBusy = true;
+    // The GDEY075T7 pulls BSY low while it is busy
+    constexpr uint8_t BusyLevel = LOW;
+    // Wake up at the latest after this many milliseconds in case the pin
+    // change is missed, the driver then checks the pin and its own timeout
+    constexpr uint32_t BusySleepTimeout = 500;
 }
\ No newline at end of file
@@ -0,0 +1,28 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Freshness policy for the data sources fetched from the GitHub API
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace FetchConfig
+{
+    // Time-to-live per data source in seconds
+    constexpr uint32_t ProfileTTL = 24UL * 3600UL;
+    constexpr uint32_t CalendarTTL = 3600UL;
+    constexpr uint32_t ReposTTL = 7UL * 24UL * 3600UL;
+
+    // Wakes may happen slightly early, treat data this close to its TTL as stale
+    constexpr uint32_t Tolerance = 120UL;
+
+    // Share of the rate limit left for other devices using the same token
+    constexpr float RateLimitReserve = 0.10f;
+    // Below this share of the limit optional requests are dropped
+    constexpr float RateLimitLow = 0.25f;
+    // Upper bound for a sleep interval stretched by the rate limit
+    constexpr uint64_t RateLimitMaxSleep = 6ULL * 3600ULL * 1000000ULL;
+}
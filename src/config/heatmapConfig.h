@@ -0,0 +1,30 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Settings for mapping contribution counts to heatmap gray levels
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace HeatmapConfig
+{
+    enum class Mode : uint8_t
+    {
+        Linear,      // Proportional to the busiest day, one outlier fades the rest
+        Quantile,    // Equal shares of the active days per level, like GitHub's calendar
+        Logarithmic, // Proportional to log(1 + count)
+    };
+
+    constexpr Mode Scaling = Mode::Quantile;
+
+    // Gray levels of days without and with the most contributions
+    constexpr uint8_t MinLevel = 3;
+    constexpr uint8_t MaxLevel = 16;
+
+    // Counts below this are looked up in a table, larger counts are compared
+    // against the level thresholds
+    constexpr uint16_t TableSize = 256;
+}
@@ -0,0 +1,22 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Storage settings for the contribution history kept on flash
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace HistoryConfig
+{
+    constexpr char Path[] = "/history.bin";
+
+    // Years kept, older years are overwritten by newer ones
+    constexpr uint8_t Years = 8;
+
+    // Days with more contributions than fit into a nibble per year. When the
+    // table is full further days are stored as the largest nibble value.
+    constexpr uint8_t MaxEscapes = 128;
+}
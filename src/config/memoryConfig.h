@@ -0,0 +1,24 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Memory budget of one wake for the ESP32 GitHub profile display
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace MemoryConfig
+{
+    // Arena reserved at boot for the JSON documents, models and render
+    // temporaries of one wake. Two calendar sized documents can be parsed
+    // at the same time with room to spare, see the high water mark in the log.
+    constexpr size_t ArenaSize = 64 * 1024;
+
+    // Budgets checked at every checkpoint of MemoryTelemetry. A TLS record
+    // buffer needs about 16 KiB in one piece, the rest is headroom.
+    constexpr uint32_t MinFreeHeap = 24 * 1024;
+    constexpr uint32_t MinLargestBlock = 17 * 1024;
+    constexpr uint32_t MinStackFree = 1024;
+}
@@ -9,9 +9,44 @@
 
 #include <Arduino.h>
 
+// Base URL of the GitHub API, can be pointed to a local stand-in with a build flag
+#ifndef GITHUB_API_URL
+#define GITHUB_API_URL "https://api.github.com"
+#endif
+
+// Longest wait for an address after a scan, the native tests shorten it
+#ifndef WIFI_CONNECT_TIMEOUT
+#define WIFI_CONNECT_TIMEOUT 30000
+#endif
+
 namespace Network
 {
     const char Hostname[] = "PixelPioneer GitHub Display";
 
-    const uint32_t Timeout = 30000;
+    const uint32_t Timeout = WIFI_CONNECT_TIMEOUT;
+    // Reconnecting with the cached BSSID, channel and static IP should be quick,
+    // after this many milliseconds fall back to a full scan and DHCP
+    constexpr uint32_t FastPathTimeout = 3000;
+    // Longest wait for the driver to confirm a disconnect before the next attempt
+    constexpr uint32_t DisconnectTimeout = 500;
+
+    // Concurrent GitHub requests, each on its own TLS connection and task
+    constexpr uint8_t MaxParallelRequests = 2;
+    constexpr uint32_t RequestTaskStack = 12288;
+    // Free heap a TLS connection plus its gzip inflate state needs before it is started
+    constexpr uint32_t RequestHeapBudget = 90000;
+    // Shared deadline for all requests of one wake in milliseconds
+    constexpr uint32_t RequestDeadline = 20000;
+
+    // Ask for gzip compressed responses and inflate them while parsing
+    constexpr bool UseGzip = true;
+    constexpr size_t GzipInputBuffer = 512;
+
+    // Resolved addresses are reused for this many seconds across deep sleep.
+    // The Arduino resolver does not expose record TTLs, so one value is used.
+    constexpr uint32_t DnsTTL = 3600;
+
+    // CPU clock once the radio is off, rendering and the panel refresh do not
+    // need more. 80 MHz keeps the APB and SPI clocks unchanged.
+    constexpr uint32_t RadioOffCpuFrequency = 80;
 }
\ No newline at end of file
@@ -18,4 +18,7 @@ namespace Pins
     constexpr uint8_t DC = 17;  // Data/Command pin
     constexpr uint8_t CS = 5;   // Chip Select pin
 
+    // ------------------- Power -------------------
+    constexpr uint8_t Battery = 35; // Battery voltage divider, ADC1 works while WiFi is on
+
 }
@@ -0,0 +1,61 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Battery measurement, discharge curve and power policy for the
+ *              ESP32 GitHub profile display
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace PowerConfig
+{
+    // Battery voltage = ADC voltage * DividerRatio
+    constexpr float DividerRatio = 2.0f;
+    // ADC readings averaged per measurement, the lowest and highest are dropped
+    constexpr uint8_t Samples = 16;
+    // Below this voltage no battery is connected, e.g. powered over USB
+    constexpr uint16_t NoBatteryMv = 2500;
+    // A rise of this much since the last wake means the battery is charging
+    constexpr uint16_t ChargingRiseMv = 40;
+    // Charging ends once the voltage fell this much below its peak while charging.
+    // The charger holds the voltage flat near full, so no rise is not the end.
+    constexpr uint16_t ChargingDropMv = 30;
+
+    struct CurvePoint
+    {
+        uint16_t mv;
+        uint8_t percent;
+    };
+
+    // Single cell LiPo discharge curve at low load, highest voltage first
+    constexpr CurvePoint DischargeCurve[] = {
+        {4200, 100},
+        {4100, 90},
+        {4000, 78},
+        {3900, 64},
+        {3800, 48},
+        {3750, 38},
+        {3700, 25},
+        {3650, 15},
+        {3600, 8},
+        {3500, 3},
+        {3300, 0},
+    };
+
+    constexpr uint16_t CapacityMah = 1000;
+
+    // Current model for the runtime estimate, the durations are measured every wake
+    constexpr float RadioOnMa = 120.0f;
+    constexpr float ActiveMa = 40.0f;
+    constexpr float DeepSleepUa = 150.0f;
+
+    // Below LowPercent wakes are spaced LowIntervalFactor times further apart,
+    // below CriticalPercent CriticalIntervalFactor times and optional data is skipped
+    constexpr uint8_t LowPercent = 30;
+    constexpr uint8_t LowIntervalFactor = 2;
+    constexpr uint8_t CriticalPercent = 10;
+    constexpr uint8_t CriticalIntervalFactor = 4;
+}
@@ -0,0 +1,26 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Limits of the repository scan over all pages of a user
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+namespace RepoConfig
+{
+    // Repositories per GraphQL page, 100 is the largest page GitHub serves
+    constexpr uint8_t PageSize = 100;
+    // Stop after this many pages, 5000 repositories, larger accounts keep the
+    // cached stars
+    constexpr uint8_t MaxPages = 50;
+
+    // Repositories with the most stars that are kept
+    constexpr uint8_t TopRepos = 5;
+    // Languages per repository, ordered by size
+    constexpr uint8_t LanguagesPerRepo = 10;
+    // Languages summed over all repositories, further languages share the last slot
+    constexpr uint8_t MaxLanguages = 16;
+}
@@ -0,0 +1,39 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Users whose calendars are fetched together and shown in turn
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "resources/credentials.h"
+
+namespace TeamConfig
+{
+    // Define GITHUB_TEAM in credentials.h as a list of logins, e.g.
+    // #define GITHUB_TEAM "octocat", "hubot"
+    // The first one is GITHUB_USERNAME, whose history and streaks are kept
+    constexpr const char *Users[] = {
+        GITHUB_USERNAME,
+#ifdef GITHUB_TEAM
+        GITHUB_TEAM
+#endif
+    };
+
+    constexpr uint8_t UserCount = sizeof(Users) / sizeof(Users[0]);
+
+    // Each user adds about 11 KB to the uncompressed response
+    constexpr uint8_t MaxUsers = 10;
+    static_assert(UserCount <= MaxUsers, "Too many users in GITHUB_TEAM");
+
+    // Show the next user on every wake instead of only GITHUB_USERNAME
+    constexpr bool Rotate = true;
+    // Include the summed calendar of the whole team in the rotation
+    constexpr bool ShowAggregate = true;
+    constexpr char AggregateName[] = "team";
+
+    constexpr char Path[] = "/team.bin";
+}
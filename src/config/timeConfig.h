@@ -8,13 +8,42 @@
 #pragma once
 
 #include <Arduino.h>
+#include <time.h>
 
 namespace TimeConfig
 {
     constexpr char Server[] = "pool.ntp.org";
 
-    constexpr long GmtOffset = 3600;
-    constexpr long DstOffset = 3600;
+    // Any epoch before this means the clock was never set
+    constexpr time_t MinValidTime = 1700000000;
 
+    // POSIX timezone with DST rules (Central European Time)
+    constexpr char Timezone[] = "CET-1CEST,M3.5.0,M10.5.0/3";
+
+    // The RTC keeps time across deep sleep, a full NTP sync is only done
+    // every SyncEveryWakes wakes or when the drift got too large
+    constexpr uint16_t SyncEveryWakes = 24;
+    // Drift in seconds corrected from the Date header of a GitHub response
+    constexpr uint32_t MaxDrift = 2;
+    // Drift in seconds that forces an NTP sync on the next wake
+    constexpr uint32_t ResyncDrift = 30;
+
+    // The contribution calendar starts on the Sunday this many weeks before
+    // the current week, GitHubStats::commits holds them plus the current week
+    constexpr uint8_t CalendarWeeks = 52;
+
+    // Fallback sleep while the clock is not set
     constexpr uint64_t SleepTime = 3600ULL * 1000000ULL;
+
+    // Wakes are aligned to full hours, WakeInterval must be a multiple of an hour
+    constexpr uint32_t WakeInterval = 3600;
+    // Interval once the calendar did not change for IdleAfterWakes fetches
+    constexpr uint32_t IdleWakeInterval = 3 * 3600;
+    constexpr uint8_t IdleAfterWakes = 3;
+    // Wake shortly after local midnight so the new day shows up promptly
+    constexpr uint32_t MidnightDelay = 60;
+    // Between midnight and this local hour the next wake is at NightEndHour
+    constexpr uint8_t NightEndHour = 7;
+    // Never sleep less than this many seconds, skip to the next boundary instead
+    constexpr uint32_t MinSleep = 300;
 }
\ No newline at end of file
@@ -0,0 +1,133 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Maps contribution counts to heatmap gray levels. The thresholds
+ *              are derived once per render from a histogram of the calendar,
+ *              each cell is then a table lookup.
+ */
+
+#include "HeatmapScale.h"
+
+#include <math.h>
+
+/**
+ * Derive the level thresholds of a calendar and fill the lookup table
+ * @param counts Contributions per day
+ * @param days Number of days shown
+ * @param mode Scaling of counts to levels
+ */
+void HeatmapScale::build(const uint16_t *counts, const size_t days, const HeatmapConfig::Mode mode)
+{
+    // Counting sort, counts beyond the table share the last bin
+    uint16_t histogram[HeatmapConfig::TableSize] = {};
+    uint16_t max = 0;
+
+    for (size_t i = 0; i < days; i++)
+    {
+        const uint16_t count = counts[i];
+        histogram[count < HeatmapConfig::TableSize ? count : HeatmapConfig::TableSize - 1]++;
+        if (count > max)
+            max = count;
+    }
+
+    _mode = mode;
+
+    for (uint8_t step = 0; step < Steps; step++)
+        _thresholds[step] = UINT16_MAX;
+
+    if (max > 0)
+    {
+        switch (mode)
+        {
+        case HeatmapConfig::Mode::Linear:
+            linear(max);
+            break;
+        case HeatmapConfig::Mode::Quantile:
+            quantile(histogram, days - histogram[0]);
+            break;
+        case HeatmapConfig::Mode::Logarithmic:
+            logarithmic(max);
+            break;
+        }
+    }
+
+    uint8_t step = 0;
+    for (uint16_t count = 0; count < HeatmapConfig::TableSize; count++)
+    {
+        while (step < Steps && _thresholds[step] <= count)
+            step++;
+        _table[count] = HeatmapConfig::MinLevel + step;
+    }
+}
+
+void HeatmapScale::print() const
+{
+    static const char *const Modes[] = {"linear", "quantile", "log"};
+
+    Serial.printf("[Heatmap] %s thresholds:", Modes[(uint8_t)_mode]);
+    for (uint8_t step = 0; step < Steps && _thresholds[step] != UINT16_MAX; step++)
+        Serial.printf(" %u", _thresholds[step]);
+    Serial.println();
+}
+
+/**
+ * Same levels as map(count, 0, max, MinLevel, MaxLevel)
+ */
+void HeatmapScale::linear(const uint16_t max)
+{
+    for (uint8_t step = 1; step <= Steps; step++)
+        _thresholds[step - 1] = ((uint32_t)step * max + Steps - 1) / Steps;
+}
+
+/**
+ * Give every level above MinLevel an equal share of the active days, a count
+ * is as dark as the share of active days with at most as many contributions
+ * @param histogram Days per count
+ * @param active Days with at least one contribution
+ */
+void HeatmapScale::quantile(const uint16_t *histogram, const uint32_t active)
+{
+    uint32_t cumulative = 0;
+    uint8_t step = 0;
+
+    for (uint16_t count = 1; count < HeatmapConfig::TableSize && step < Steps; count++)
+    {
+        cumulative += histogram[count];
+        while (step < Steps && cumulative * Steps > step * active)
+            _thresholds[step++] = count;
+    }
+}
+
+/**
+ * Scale log(1 + count) linearly up to the busiest day
+ */
+void HeatmapScale::logarithmic(const uint16_t max)
+{
+    uint16_t previous = 1;
+
+    for (uint8_t step = 1; step <= Steps; step++)
+    {
+        // Smallest count with log(1 + count) >= step / Steps * log(1 + max)
+        const float bound = powf(1.0f + max, (float)step / Steps) - 1.0f;
+        uint16_t threshold = (uint16_t)ceilf(bound - 1e-3f);
+
+        if (threshold < previous)
+            threshold = previous;
+        if (threshold > max)
+            threshold = max;
+
+        _thresholds[step - 1] = previous = threshold;
+    }
+}
+
+/**
+ * Level of a count beyond the lookup table
+ */
+uint8_t HeatmapScale::levelOf(const uint16_t count) const
+{
+    uint8_t step = 0;
+    while (step < Steps && _thresholds[step] <= count)
+        step++;
+    return HeatmapConfig::MinLevel + step;
+}
@@ -0,0 +1,41 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Maps contribution counts to heatmap gray levels. The thresholds
+ *              are derived once per render from a histogram of the calendar,
+ *              each cell is then a table lookup.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "config/heatmapConfig.h"
+
+class HeatmapScale
+{
+public:
+    void build(const uint16_t *counts, const size_t days, const HeatmapConfig::Mode mode = HeatmapConfig::Scaling);
+
+    uint8_t level(const uint16_t count) const
+    {
+        return count < HeatmapConfig::TableSize ? _table[count] : levelOf(count);
+    }
+
+    void print() const;
+
+private:
+    static constexpr uint8_t Steps = HeatmapConfig::MaxLevel - HeatmapConfig::MinLevel;
+
+    void linear(const uint16_t max);
+    void quantile(const uint16_t *histogram, const uint32_t active);
+    void logarithmic(const uint16_t max);
+    uint8_t levelOf(const uint16_t count) const;
+
+    HeatmapConfig::Mode _mode = HeatmapConfig::Scaling;
+
+    // Smallest count of each level above MinLevel, ascending
+    uint16_t _thresholds[Steps] = {};
+    uint8_t _table[HeatmapConfig::TableSize] = {};
+};
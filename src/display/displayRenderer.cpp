@@ -6,6 +6,10 @@
  */
 #include "displayRenderer.h"
 
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+
 DisplayRenderer::DisplayRenderer()
     : _display(DisplayConfig::DisplayModel(Pins::BSY, Pins::BSY, Pins::BSY, Pins::BSY)),
       _dithering(_display)
@@ -19,23 +23,36 @@ void DisplayRenderer::init(const int rotation,
     _display.setRotation(rotation);
     _display.setTextColor(textColor);
     _display.firstPage();
+
+    if (DisplayConfig::LightSleepWhileBusy)
+        _display.epd2.setBusyCallback(waitWhileBusy);
 }
 
 void DisplayRenderer::drawDashboard(const GitHubStats *stats,
                                     const GitHubProfile *profile,
-                                    const DeviceInformation &deviceInformation)
+                                    const WakeContext &context)
 {
+    const uint32_t start = millis();
+
+    // Scale the levels to the days shown once, not for every page. The
+    // current week ends today.
+    HeatmapScale scale;
+    scale.build(stats->commits, TimeConfig::CalendarWeeks * 7 + context.weekday + 1);
+    scale.print();
+
     do
     {
         _display.clearScreen();
         drawStatistics(stats);
-        drawHeatmap(stats, deviceInformation);
-        drawFooter(profile, deviceInformation);
+        drawHeatmap(stats, context, scale);
+        drawFooter(profile, context);
     } while (_display.nextPage());
+    renderMs += millis() - start;
 }
 
 void DisplayRenderer::drawConnectionError()
 {
+    const uint32_t start = millis();
     _display.setFont(&Roboto_Regular_11pt8b);
     do
     {
@@ -57,6 +74,7 @@ void DisplayRenderer::drawConnectionError()
         _display.setCursor(400 - (tbw / 2), tby);
         _display.print("failed");
     } while (_display.nextPage());
+    renderMs += millis() - start;
 }
 
 void DisplayRenderer::drawStatistics(const GitHubStats *stats)
@@ -129,7 +147,7 @@ void DisplayRenderer::drawStatistics(const GitHubStats *stats)
     _display.print(getStrings().averagePerDay);
 }
 
-void DisplayRenderer::drawFooter(const GitHubProfile *profile, const DeviceInformation &deviceInformation)
+void DisplayRenderer::drawFooter(const GitHubProfile *profile, const WakeContext &context)
 {
     int16_t tbx, tby;
     uint16_t tbw, tbh;
@@ -138,53 +156,130 @@ void DisplayRenderer::drawFooter(const GitHubProfile *profile, const DeviceInfor
     _display.setFont(&Roboto_Regular_6pt8b);
     _display.fillRect(0, 464, 16, 16, GxEPD_BLACK);
     _display.drawBitmap(0, 464, sy_github_16x16, 16, 16, GxEPD_WHITE);
-    _display.getTextBounds(String(profile->username) + " (" + profile->name + ")", 0, 0, &tbx, &tby, &tbw, &tbh);
+    const char *account = Arena::wake().printf("%s (%s)", profile->username.c_str(), profile->name.c_str());
+    _display.getTextBounds(account, 0, 0, &tbx, &tby, &tbw, &tbh);
     _display.setCursor(20, DisplayConfig::Width - tbh * 0.25);
-    _display.print(String(profile->username) + " (" + profile->name + ")");
+    _display.print(account);
 
     // Display current date and time in footer
-    _display.getTextBounds(deviceInformation.time_string, 0, 0, &tbx, &tby, &tbw, &tbh);
+    _display.getTextBounds(context.timeString, 0, 0, &tbx, &tby, &tbw, &tbh);
     _display.setCursor(795 - tbw, DisplayConfig::Width - tbh * 0.33);
-    _display.print(deviceInformation.time_string);
+    _display.print(context.timeString);
 
     _display.fillRect(770 - tbw, 464, 16, 16, GxEPD_BLACK);
     _display.drawBitmap(770 - tbw, 464, wi_time_1_16x16, 16, 16, GxEPD_WHITE);
 
     // Display WiFi signal strength with appropriate icon
-    _display.getTextBounds(String(deviceInformation.WiFi_Description) + " (" + deviceInformation.WiFi_Strength + " dbm)", 770 - tbw, DisplayConfig::Width, &tbx, &tby, &tbw, &tbh);
+    const char *signal = Arena::wake().printf("%s (%d dBm)", context.device.WiFi_Description.c_str(), context.device.WiFi_Strength);
+    _display.getTextBounds(signal, 770 - tbw, DisplayConfig::Width, &tbx, &tby, &tbw, &tbh);
     _display.setCursor(tbx - 10 - tbw, DisplayConfig::Width - tbh * 0.33);
-    _display.print(String(deviceInformation.WiFi_Description) + " (" + deviceInformation.WiFi_Strength + " dBm)");
+    _display.print(signal);
     _display.fillRect(tbx - 31 - tbw, 464, 16, 16, GxEPD_BLACK);
 
-    if (deviceInformation.WiFi_Description == getStrings().excellent)
+    if (context.device.WiFi_Description == getStrings().excellent)
         _display.drawBitmap(tbx - 31 - tbw, 464, wifi_16x16, 16, 16, GxEPD_WHITE);
-    else if (deviceInformation.WiFi_Description == getStrings().good)
+    else if (context.device.WiFi_Description == getStrings().good)
         _display.drawBitmap(tbx - 31 - tbw, 464, wifi_3_bar_16x16, 16, 16, GxEPD_WHITE);
-    else if (deviceInformation.WiFi_Description == getStrings().fair)
+    else if (context.device.WiFi_Description == getStrings().fair)
         _display.drawBitmap(tbx - 31 - tbw, 464, wifi_2_bar_16x16, 16, 16, GxEPD_WHITE);
-    else if (deviceInformation.WiFi_Description == getStrings().weak)
+    else if (context.device.WiFi_Description == getStrings().weak)
         _display.drawBitmap(tbx - 31 - tbw, 464, wifi_1_bar_16x16, 16, 16, GxEPD_WHITE);
+
+    // Display battery charge left of the WiFi signal strength
+    if (context.device.battery < 0)
+        return;
+
+    const int16_t wifiIconX = tbx - 31 - tbw;
+    const char *battery = Arena::wake().printf("%d%%", (int)context.device.battery);
+    _display.getTextBounds(battery, 0, 0, &tbx, &tby, &tbw, &tbh);
+    _display.setCursor(wifiIconX - 10 - tbw, DisplayConfig::Width - tbh * 0.33);
+    _display.print(battery);
+
+    const int16_t batteryIconX = wifiIconX - 31 - tbw;
+    _display.fillRect(batteryIconX, 464, 16, 16, GxEPD_BLACK);
+    _display.drawBitmap(batteryIconX, 464, batteryIcon(context.device), 16, 16, GxEPD_WHITE);
 }
 
-void DisplayRenderer::drawHeatmap(const GitHubStats *stats, const DeviceInformation &deviceInformation)
+/**
+ * Battery icon for the footer, the bars follow the charge in steps of 1/7
+ * @param device Battery state of this wake
+ */
+const unsigned char *DisplayRenderer::batteryIcon(const DeviceInformation &device)
 {
-    // Render contribution heatmap (53 weeks x 7 days)
-    for (int week = 0; week < 53; week++)
+    static const unsigned char *const bars[] = {
+        battery_0_bar_0deg_16x16, battery_1_bar_0deg_16x16, battery_2_bar_0deg_16x16,
+        battery_3_bar_0deg_16x16, battery_4_bar_0deg_16x16, battery_5_bar_0deg_16x16,
+        battery_6_bar_0deg_16x16};
+
+    if (device.charging)
+        return battery_charging_full_0deg_16x16;
+    if (device.battery < PowerConfig::CriticalPercent)
+        return battery_alert_0deg_16x16;
+    if (device.battery >= 95)
+        return battery_full_0deg_16x16;
+
+    return bars[(int)device.battery * 7 / 100];
+}
+
+void DisplayRenderer::drawHeatmap(const GitHubStats *stats, const WakeContext &context, const HeatmapScale &scale)
+{
+    // Render contribution heatmap (53 weeks x 7 days), commits[0] is the first Sunday
+    for (int week = 0; week <= TimeConfig::CalendarWeeks; week++)
     {
         for (int day = 0; day < 7; day++)
         {
-            if (week == 52 && day > deviceInformation.weekday)
-                break;
-            int index = week * 7 + day;
-            if (index >= 371)
+            if (week == TimeConfig::CalendarWeeks && day > context.weekday)
                 break;
+            const int index = week * 7 + day;
             // Map contribution count to grayscale level (3=light, 16=dark)
-            int color = map(stats->commits[index], 0, stats->maxContributions, 3, 16);
-            _dithering.fillGrayRoundRect(Layout::HeatmapX + week * 15, Layout::HeatmapY + day * 33, 10, 27, 2, color);
+            _dithering.fillGrayRoundRect(Layout::HeatmapX + week * 15, Layout::HeatmapY + day * 33, 10, 27, 2, scale.level(stats->commits[index]));
         }
     }
 }
 
 void DisplayRenderer::hibernate() {
+    // Powering the panel off waits for the busy pin as well
+    const uint32_t start = millis();
     _display.hibernate();
+    renderMs += millis() - start;
+}
+
+/**
+ * Busy callback of the display driver, called repeatedly while the panel is busy
+ * Instead of polling the pin the ESP32 light sleeps until the pin leaves the
+ * busy level, or the fallback timer fires.
+ * @param parameter Unused
+ */
+void DisplayRenderer::waitWhileBusy(const void *parameter)
+{
+    const uint32_t start = millis();
+
+    if (digitalRead(Pins::BSY) == DisplayConfig::BusyLevel)
+    {
+        const gpio_int_type_t wakeLevel = DisplayConfig::BusyLevel == LOW ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL;
+        gpio_wakeup_enable((gpio_num_t)Pins::BSY, wakeLevel);
+        esp_sleep_enable_gpio_wakeup();
+        esp_sleep_enable_timer_wakeup(DisplayConfig::BusySleepTimeout * 1000ULL);
+
+        const int64_t sleepStart = esp_timer_get_time();
+        esp_light_sleep_start();
+        sleptMs += (esp_timer_get_time() - sleepStart) / 1000;
+
+        esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+        esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+        gpio_wakeup_disable((gpio_num_t)Pins::BSY);
+    }
+
+    busyMs += millis() - start;
+}
+
+void DisplayRenderer::printTiming()
+{
+    if (renderMs == 0)
+        return;
+
+    const uint32_t activeMs = renderMs > sleptMs ? renderMs - sleptMs : 0;
+    Serial.printf("[Profiler] panel: busy %lu ms, light sleep %lu ms, cpu active %lu of %lu ms\n",
+                  (unsigned long)busyMs, (unsigned long)sleptMs,
+                  (unsigned long)activeMs, (unsigned long)renderMs);
 }
\ No newline at end of file
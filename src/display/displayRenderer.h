@@ -13,12 +13,16 @@
 #include "config/displayConfig.h"
 #include "config/layout.h"
 #include "config/pins.h"
+#include "config/powerConfig.h"
+#include "config/timeConfig.h"
 #include "i18n/i18n.h"
+#include "memory/Arena.h"
 #include "models/GitHubProfile.h"
 #include "models/GitHubStats.h"
-#include "models/deviceInformation.h"
+#include "models/wakeContext.h"
 
 #include "dithering.h"
+#include "HeatmapScale.h"
 
 class DisplayRenderer
 {
@@ -27,10 +31,11 @@ public:
 
     void drawDashboard(const GitHubStats *stats,
                        const GitHubProfile *profile,
-                       const DeviceInformation &deviceInformation);
+                       const WakeContext &context);
     void drawConnectionError();
     void init(const int rotation, const uint16_t textColor);
     void hibernate();
+    static void printTiming();
 
 private:
     DisplayConfig::DisplayType _display;
@@ -38,7 +43,15 @@ private:
     Dithering _dithering;
 
     void drawStatistics(const GitHubStats *stats);
-    void drawHeatmap(const GitHubStats *stats, const DeviceInformation &deviceInformation);
+    void drawHeatmap(const GitHubStats *stats, const WakeContext &context, const HeatmapScale &scale);
     void drawFooter(const GitHubProfile *profile,
-                    const DeviceInformation &deviceInformation);
+                    const WakeContext &context);
+
+    static const unsigned char *batteryIcon(const DeviceInformation &device);
+    static void waitWhileBusy(const void *parameter);
+
+    // Time spent drawing and refreshing, waiting for the busy pin and in light sleep
+    inline static uint32_t renderMs = 0;
+    inline static uint32_t busyMs = 0;
+    inline static uint32_t sleptMs = 0;
 };
\ No newline at end of file
@@ -0,0 +1,159 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Decides which GitHub API requests are issued on a wake based on
+ *              the age of the data kept across deep sleep and the active layout.
+ */
+
+#include "FetchPlanner.h"
+
+/**
+ * Build the fetch plan for this wake
+ * @param now Current epoch time in seconds
+ * @param required Mask of the data sources the active layout renders
+ */
+void FetchPlanner::plan(const time_t now, const uint8_t required)
+{
+    _now = now;
+    _required = required;
+    _planned = 0;
+    _deferred = 0;
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(DataSource::Count); i++)
+    {
+        const DataSource source = static_cast<DataSource>(i);
+        if ((required & mask(source)) && isStale(source))
+            _planned |= mask(source);
+    }
+}
+
+bool FetchPlanner::shouldFetch(const DataSource source) const
+{
+    return _planned & mask(source);
+}
+
+/**
+ * Check whether data for a source has been fetched since the last cold boot
+ * @param source Data source to check
+ * @return true if a cached copy exists
+ */
+bool FetchPlanner::hasData(const DataSource source) const
+{
+    return lastFetch[static_cast<uint8_t>(source)] != 0;
+}
+
+/**
+ * Drop a planned request for this wake, e.g. when the rate limit runs low
+ * Only sources with cached data can be deferred.
+ * @param source Data source to skip
+ * @param reason Why it is skipped, shown by printPlan()
+ */
+void FetchPlanner::defer(const DataSource source, const DeferReason reason)
+{
+    if (shouldFetch(source) && hasData(source))
+    {
+        _planned &= ~mask(source);
+        _deferred |= mask(source);
+        _reasons[static_cast<uint8_t>(source)] = reason;
+    }
+}
+
+void FetchPlanner::markFetched(const DataSource source, const time_t now)
+{
+    lastFetch[static_cast<uint8_t>(source)] = now;
+}
+
+/**
+ * Log the plan, including which requests were skipped and why
+ */
+void FetchPlanner::printPlan() const
+{
+    uint8_t skipped = 0;
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(DataSource::Count); i++)
+    {
+        const DataSource source = static_cast<DataSource>(i);
+        const time_t last = lastFetch[i];
+
+        if (shouldFetch(source))
+        {
+            Serial.printf("[Fetch] %s: fetch\n", name(source));
+        }
+        else if (_deferred & mask(source))
+        {
+            Serial.printf("[Fetch] %s: skipped (%s)\n", name(source),
+                          _reasons[i] == DeferReason::Battery ? "battery critical" : "rate limit low");
+            skipped++;
+        }
+        else if (!(_required & mask(source)))
+        {
+            Serial.printf("[Fetch] %s: skipped (not used by layout)\n", name(source));
+            skipped++;
+        }
+        else
+        {
+            Serial.printf("[Fetch] %s: skipped (age %ld s, ttl %lu s)\n",
+                          name(source), (long)(_now - last), (unsigned long)ttl(source));
+            skipped++;
+        }
+    }
+
+    Serial.printf("[Fetch] %u of %u requests skipped\n", skipped, static_cast<uint8_t>(DataSource::Count));
+}
+
+uint32_t FetchPlanner::ttl(const DataSource source)
+{
+    switch (source)
+    {
+    case DataSource::Profile:
+        return FetchConfig::ProfileTTL;
+    case DataSource::Calendar:
+        return FetchConfig::CalendarTTL;
+    case DataSource::Repos:
+    default:
+        return FetchConfig::ReposTTL;
+    }
+}
+
+const char *FetchPlanner::name(const DataSource source)
+{
+    switch (source)
+    {
+    case DataSource::Profile:
+        return "profile";
+    case DataSource::Calendar:
+        return "calendar";
+    case DataSource::Repos:
+    default:
+        return "repos";
+    }
+}
+
+/**
+ * Determine whether the cached data of a source has to be refreshed
+ * @param source Data source to check
+ * @return true if never fetched, the clock is unset, the TTL expired or,
+ *         for the calendar, the local day changed since the last fetch
+ */
+bool FetchPlanner::isStale(const DataSource source) const
+{
+    const time_t last = lastFetch[static_cast<uint8_t>(source)];
+
+    if (last == 0 || _now < TimeConfig::MinValidTime || _now < last)
+        return true;
+
+    if ((uint32_t)(_now - last) + FetchConfig::Tolerance >= ttl(source))
+        return true;
+
+    if (source == DataSource::Calendar)
+    {
+        tm lastLocal, nowLocal;
+        localtime_r(&last, &lastLocal);
+        localtime_r(&_now, &nowLocal);
+        if (lastLocal.tm_yday != nowLocal.tm_yday || lastLocal.tm_year != nowLocal.tm_year)
+            return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,60 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Decides which GitHub API requests are issued on a wake based on
+ *              the age of the data kept across deep sleep and the active layout.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "config/fetchConfig.h"
+#include "config/timeConfig.h"
+
+enum class DataSource : uint8_t
+{
+    Profile,
+    Calendar,
+    Repos,
+    Count
+};
+
+// Why a planned request was dropped for this wake
+enum class DeferReason : uint8_t
+{
+    RateLimit,
+    Battery
+};
+
+class FetchPlanner
+{
+public:
+    static constexpr uint8_t mask(const DataSource source)
+    {
+        return 1 << static_cast<uint8_t>(source);
+    }
+
+    void plan(const time_t now, const uint8_t required);
+    bool shouldFetch(const DataSource source) const;
+    bool hasData(const DataSource source) const;
+    void defer(const DataSource source, const DeferReason reason);
+    void markFetched(const DataSource source, const time_t now);
+    void printPlan() const;
+
+private:
+    static uint32_t ttl(const DataSource source);
+    static const char *name(const DataSource source);
+    bool isStale(const DataSource source) const;
+
+    time_t _now = 0;
+    uint8_t _required = 0;
+    uint8_t _planned = 0;
+    uint8_t _deferred = 0;
+    DeferReason _reasons[static_cast<uint8_t>(DataSource::Count)] = {};
+
+    // Last successful fetch per source (epoch seconds), kept across deep sleep
+    inline static RTC_DATA_ATTR time_t lastFetch[static_cast<uint8_t>(DataSource::Count)] = {0};
+};
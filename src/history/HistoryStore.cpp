@@ -0,0 +1,313 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Contribution history of several years in a LittleFS file,
+ *              one fixed size block per year with a nibble per day and an
+ *              escape table for days with many contributions.
+ */
+
+#include "HistoryStore.h"
+
+#include <stddef.h>
+
+/**
+ * Mount LittleFS and create the history file with empty blocks if needed
+ * @return false if the file system is not available
+ */
+bool HistoryStore::begin()
+{
+    if (mounted)
+        return true;
+
+    if (!LittleFS.begin(true))
+    {
+        Serial.println("[History] Unable to mount LittleFS");
+        return false;
+    }
+
+    const size_t size = sizeof(YearBlock) * HistoryConfig::Years;
+    if (!LittleFS.exists(HistoryConfig::Path) || LittleFS.open(HistoryConfig::Path, "r").size() != size)
+    {
+        File file = LittleFS.open(HistoryConfig::Path, "w");
+        const YearBlock empty = {};
+        for (uint8_t i = 0; i < HistoryConfig::Years; i++)
+            file.write(reinterpret_cast<const uint8_t *>(&empty), sizeof(empty));
+        file.close();
+    }
+
+    mounted = true;
+    return true;
+}
+
+/**
+ * Store the days of a fetched calendar, only blocks that changed are written
+ * Days of the first week before the requested range are not part of the
+ * response and keep what an earlier fetch stored.
+ * @param stats Fetched calendar
+ * @param today Current day since 1970-01-01, later days are not stored
+ * @return false if the file could not be written
+ */
+bool HistoryStore::store(const GitHubStats &stats, const int32_t today)
+{
+    if (!begin() || stats.startDay <= 0 || stats.firstDay < stats.startDay)
+        return false;
+
+    const size_t total = sizeof(stats.commits) / sizeof(stats.commits[0]);
+    size_t last = today - stats.startDay;
+    if (last >= total)
+        last = total - 1;
+
+    YearBlock block;
+    int32_t year = 0;
+    bool changed = false;
+
+    for (size_t i = stats.firstDay - stats.startDay; i <= last; i++)
+    {
+        const int32_t day = stats.startDay + i;
+        const int32_t dayYear = TimeUtils::yearFromDays(day);
+
+        if (dayYear != year)
+        {
+            if (changed && !save(block))
+                return false;
+
+            year = dayYear;
+            load(year, block);
+            changed = false;
+        }
+
+        // Compare with what set() would store, a capped day would otherwise
+        // rewrite the block on every fetch
+        const uint16_t yday = day - TimeUtils::daysFromCivil(year, 1, 1);
+        if (decode(block, yday) != encoded(block, yday, stats.commits[i]))
+        {
+            set(block, yday, stats.commits[i]);
+            changed = true;
+        }
+    }
+
+    return !changed || save(block);
+}
+
+/**
+ * Contributions of one day, reads a single byte unless the day is escaped
+ * @param day Day since 1970-01-01
+ * @return 0 for days that are not stored
+ */
+uint16_t HistoryStore::get(const int32_t day)
+{
+    if (!begin())
+        return 0;
+
+    const int32_t year = TimeUtils::yearFromDays(day);
+    const uint16_t yday = day - TimeUtils::daysFromCivil(year, 1, 1);
+
+    File file = LittleFS.open(HistoryConfig::Path, "r");
+    uint16_t storedYear = 0;
+    uint8_t level = 0;
+
+    file.seek(offset(year));
+    file.read(reinterpret_cast<uint8_t *>(&storedYear), sizeof(storedYear));
+    if (storedYear != year)
+        return 0;
+
+    file.seek(offset(year) + offsetof(YearBlock, levels) + yday / 2);
+    file.read(&level, 1);
+    level = yday % 2 == 0 ? level & 0x0F : level >> 4;
+
+    if (level != Escaped)
+        return level;
+
+    YearBlock block;
+    file.seek(offset(year));
+    file.read(reinterpret_cast<uint8_t *>(&block), sizeof(block));
+    return decode(block, yday);
+}
+
+/**
+ * Read consecutive days, every year block is read once
+ * @param firstDay First day since 1970-01-01
+ * @param counts Receives the contributions per day
+ * @param days Number of days to read
+ * @return Number of days read
+ */
+size_t HistoryStore::read(const int32_t firstDay, uint16_t *counts, const size_t days)
+{
+    if (!begin())
+        return 0;
+
+    YearBlock block;
+    int32_t yearStart = 0;
+    int32_t nextYearStart = 0;
+
+    for (size_t i = 0; i < days; i++)
+    {
+        const int32_t day = firstDay + i;
+        if (i == 0 || day >= nextYearStart)
+        {
+            const int32_t year = TimeUtils::yearFromDays(day);
+            yearStart = TimeUtils::daysFromCivil(year, 1, 1);
+            nextYearStart = TimeUtils::daysFromCivil(year + 1, 1, 1);
+            load(year, block);
+        }
+
+        counts[i] = decode(block, day - yearStart);
+    }
+
+    return days;
+}
+
+void HistoryStore::print()
+{
+    if (!mounted)
+        return;
+
+    File file = LittleFS.open(HistoryConfig::Path, "r");
+    YearBlock block;
+    uint8_t years = 0;
+    uint32_t escapes = 0;
+
+    for (uint8_t i = 0; i < HistoryConfig::Years; i++)
+    {
+        if (file.read(reinterpret_cast<uint8_t *>(&block), sizeof(block)) != sizeof(block))
+            break;
+        if (block.year == 0)
+            continue;
+
+        years++;
+        escapes += block.escapeCount;
+        if (block.lossy)
+            Serial.printf("[History] %u: escape table full, some days are capped\n", block.year);
+    }
+
+    Serial.printf("[Profiler] history: %u years, %u bytes per year (%u escapes in use), %u bytes on flash, %lu blocks written\n",
+                  years, (unsigned)sizeof(YearBlock), (unsigned)escapes,
+                  (unsigned)(sizeof(YearBlock) * HistoryConfig::Years), (unsigned long)blocksWritten);
+}
+
+size_t HistoryStore::offset(const int32_t year)
+{
+    return (year % HistoryConfig::Years) * sizeof(YearBlock);
+}
+
+/**
+ * Read the block of a year, a slot that holds another year reads as empty
+ */
+bool HistoryStore::load(const int32_t year, YearBlock &block)
+{
+    File file = LittleFS.open(HistoryConfig::Path, "r");
+    const bool ok = file && file.seek(offset(year)) &&
+                    file.read(reinterpret_cast<uint8_t *>(&block), sizeof(block)) == sizeof(block);
+
+    if (!ok || block.year != year)
+    {
+        block = {};
+        block.year = year;
+    }
+
+    return ok;
+}
+
+bool HistoryStore::save(const YearBlock &block)
+{
+    File file = LittleFS.open(HistoryConfig::Path, "r+");
+    const bool ok = file && file.seek(offset(block.year)) &&
+                    file.write(reinterpret_cast<const uint8_t *>(&block), sizeof(block)) == sizeof(block);
+
+    if (ok)
+        blocksWritten++;
+    else
+        Serial.printf("[History] Unable to write %u\n", block.year);
+
+    return ok;
+}
+
+void HistoryStore::set(YearBlock &block, const uint16_t day, const uint16_t count)
+{
+    const int escape = findEscape(block, day);
+    uint8_t level = count;
+
+    if (count >= Escaped)
+    {
+        level = Escaped;
+
+        if (escape >= 0)
+        {
+            block.escapes[escape].count = count;
+        }
+        else if (block.escapeCount < HistoryConfig::MaxEscapes)
+        {
+            // Insert sorted by day
+            uint8_t position = block.escapeCount;
+            while (position > 0 && block.escapes[position - 1].day > day)
+            {
+                block.escapes[position] = block.escapes[position - 1];
+                position--;
+            }
+            block.escapes[position] = {day, count};
+            block.escapeCount++;
+        }
+        else
+        {
+            level = Escaped - 1;
+            block.lossy = 1;
+        }
+    }
+    else if (escape >= 0)
+    {
+        memmove(&block.escapes[escape], &block.escapes[escape + 1], (block.escapeCount - escape - 1) * sizeof(Escape));
+        block.escapeCount--;
+        block.escapes[block.escapeCount] = {};
+    }
+
+    uint8_t &pair = block.levels[day / 2];
+    pair = day % 2 == 0 ? (pair & 0xF0) | level : (pair & 0x0F) | (level << 4);
+}
+
+/**
+ * Count a day reads back as once set() stored it
+ * Days that do not fit into a full escape table are capped below Escaped.
+ */
+uint16_t HistoryStore::encoded(const YearBlock &block, const uint16_t day, const uint16_t count)
+{
+    if (count >= Escaped && block.escapeCount >= HistoryConfig::MaxEscapes && findEscape(block, day) < 0)
+        return Escaped - 1;
+
+    return count;
+}
+
+uint16_t HistoryStore::decode(const YearBlock &block, const uint16_t day)
+{
+    const uint8_t pair = block.levels[day / 2];
+    const uint8_t level = day % 2 == 0 ? pair & 0x0F : pair >> 4;
+
+    if (level != Escaped)
+        return level;
+
+    const int escape = findEscape(block, day);
+    return escape >= 0 ? block.escapes[escape].count : Escaped;
+}
+
+/**
+ * Binary search in the escape table
+ * @return Index of the day, -1 if it has no entry
+ */
+int HistoryStore::findEscape(const YearBlock &block, const uint16_t day)
+{
+    int low = 0;
+    int high = block.escapeCount - 1;
+
+    while (low <= high)
+    {
+        const int middle = (low + high) / 2;
+        if (block.escapes[middle].day == day)
+            return middle;
+        if (block.escapes[middle].day < day)
+            low = middle + 1;
+        else
+            high = middle - 1;
+    }
+
+    return -1;
+}
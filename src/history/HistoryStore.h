@@ -0,0 +1,59 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Contribution history of several years in a LittleFS file,
+ *              one fixed size block per year with a nibble per day and an
+ *              escape table for days with many contributions.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+
+#include "config/historyConfig.h"
+#include "models/GitHubStats.h"
+#include "time/timeUtils.h"
+
+class HistoryStore
+{
+public:
+    static bool begin();
+    static bool store(const GitHubStats &stats, const int32_t today);
+    static uint16_t get(const int32_t day);
+    static size_t read(const int32_t firstDay, uint16_t *counts, const size_t days);
+    static void print();
+
+private:
+    // Counts up to this value are stored in the nibble itself
+    static constexpr uint8_t Escaped = 15;
+
+    struct Escape
+    {
+        uint16_t day;
+        uint16_t count;
+    };
+
+    struct YearBlock
+    {
+        uint16_t year; // 0 while the block is unused
+        uint8_t escapeCount;
+        uint8_t lossy; // Set when a day did not fit into the escape table
+        uint8_t levels[183];
+        uint8_t reserved;
+        Escape escapes[HistoryConfig::MaxEscapes]; // Sorted by day
+    };
+
+    static size_t offset(const int32_t year);
+    static bool load(const int32_t year, YearBlock &block);
+    static bool save(const YearBlock &block);
+    static void set(YearBlock &block, const uint16_t day, const uint16_t count);
+    static uint16_t encoded(const YearBlock &block, const uint16_t day, const uint16_t count);
+    static uint16_t decode(const YearBlock &block, const uint16_t day);
+    static int findEscape(const YearBlock &block, const uint16_t day);
+
+    inline static bool mounted = false;
+    inline static uint32_t blocksWritten = 0;
+};
@@ -23,5 +23,7 @@ constexpr Strings German =
         "Ausgezeichnet",
         "Gut",
         "Mittel",
-        "Schwach"
-        "Keine Verbindung"};
\ No newline at end of file
+        "Schwach",
+        "Keine Verbindung",
+
+        "%u Mitglieder"};
\ No newline at end of file
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include "Language.h"
+#include "language.h"
 
 constexpr Strings English =
     {
@@ -24,4 +24,6 @@ constexpr Strings English =
         "Good",
         "Fair",
         "Weak",
-        "No Connection"};
\ No newline at end of file
+        "No Connection",
+
+        "%u members"};
\ No newline at end of file
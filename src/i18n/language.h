@@ -22,4 +22,6 @@ struct Strings
     const char* fair;
     const char* weak;
     const char* noConnection;
+
+    const char* teamMembers; // Format with the number of members
 };
\ No newline at end of file
@@ -8,7 +8,7 @@
 
 #pragma once
 
-#include "Language.h"
+#include "language.h"
 
 constexpr Strings Russian =
     {
@@ -23,5 +23,7 @@ constexpr Strings Russian =
         "Отлично",
         "Хорошо",
         "Средне",
-        "Слабо"
-        "Нет подключения"};
\ No newline at end of file
+        "Слабо",
+        "Нет подключения",
+
+        "%u участников"};
\ No newline at end of file
@@ -14,34 +14,237 @@
 #include "config/timeConfig.h"
 #include "config/displayConfig.h"
 #include "config/layout.h"
+#include "config/teamConfig.h"
 
 // Project includes
 #include "GitHub/GitHubParser.h"
+#include "GitHub/RateLimit.h"
+#include "GitHub/RequestExecutor.h"
 #include "i18n/i18n.h"
-#include "models/deviceInformation.h"
+#include "memory/Arena.h"
+#include "models/wakeContext.h"
 #include "models/GitHubProfile.h"
 #include "models/GitHubStats.h"
 #include "display/displayRenderer.h"
+#include "power/Battery.h"
+#include "fetch/FetchPlanner.h"
+#include "history/HistoryStore.h"
+#include "profiler/MemoryTelemetry.h"
+#include "profiler/WakeProfiler.h"
+#include "statistics/RollingStatistics.h"
+#include "statistics/StatisticsEngine.h"
+#include "team/TeamAggregate.h"
+#include "team/TeamStore.h"
+#include "time/SleepScheduler.h"
 #include "time/TimeManager.h"
+#include "WiFiManager/ESP32Radio.h"
 #include "WiFiManager/WiFiManager.h"
 
-DeviceInformation deviceInformation;
-GitHubProfile *profile;
-GitHubStats *stats;
+WakeContext wakeContext;
 GitHubParser ghParser(GITHUB_USERNAME);
 DisplayRenderer renderer;
+FetchPlanner planner;
+WakeProfiler profiler;
+SleepScheduler scheduler;
 TimeManager tm;
-WiFiManager wifimg;
+ESP32Radio radio;
+WiFiManager wifimg(radio);
+
+// Data of the last successful fetches, kept across deep sleep so fresh
+// sources can be skipped on the next wake
+RTC_DATA_ATTR GitHubStats cachedStats;
+RTC_DATA_ATTR GitHubProfile cachedProfile;
+
+bool fetchProfile(void *context, const uint32_t)
+{
+  GitHubProfile **result = static_cast<GitHubProfile **>(context);
+  *result = ghParser.getProfile();
+  return *result != nullptr;
+}
+
+struct StatisticsJob
+{
+  const WakeContext *context;
+  GitHubStats *result;
+  TeamMember *team;
+};
+
+bool fetchStatistics(void *context, const uint32_t)
+{
+  StatisticsJob *job = static_cast<StatisticsJob *>(context);
+
+  if (TeamConfig::UserCount < 2)
+  {
+    job->result = ghParser.getStatistics(*job->context);
+    return job->result != nullptr;
+  }
+
+  // One request for the whole team, GITHUB_USERNAME is the first member
+  job->team = ghParser.getTeam(*job->context);
+  job->result = job->team != nullptr && job->team[0].valid ? &job->team[0].stats : nullptr;
+  return job->team != nullptr;
+}
+
+bool fetchRepos(void *context, const uint32_t deadline)
+{
+  RepoSummary **result = static_cast<RepoSummary **>(context);
+  *result = ghParser.scanRepos(deadline);
+  return *result != nullptr;
+}
+
+/**
+ * Fetch the data sources selected by the planner and update the caches
+ * Independent requests run concurrently, sources that fail to fetch keep
+ * their previous cached data. Fetched results live in the wake arena.
+ */
+void fetchData(const WakeContext &context)
+{
+  const time_t now = context.now;
+
+  // The dashboard renders the profile and the contribution calendar, the
+  // repository scan adds the stars to the profile
+  planner.plan(now, FetchPlanner::mask(DataSource::Profile) | FetchPlanner::mask(DataSource::Calendar) |
+                        FetchPlanner::mask(DataSource::Repos));
+
+  // The profile is optional while the calendar is the reason to wake up at all
+  const DeferReason reason = Battery::isCritical() ? DeferReason::Battery : DeferReason::RateLimit;
+  if (RateLimit::isLow(RateResource::Core, now) || Battery::isCritical())
+    planner.defer(DataSource::Profile, reason);
+  // Every page of the scan costs a GraphQL point the calendar may need
+  if (RateLimit::isLow(RateResource::GraphQL, now) || Battery::isCritical())
+    planner.defer(DataSource::Repos, reason);
+
+  planner.printPlan();
+
+  GitHubProfile *fetchedProfile = nullptr;
+  StatisticsJob statisticsJob = {&context, nullptr, nullptr};
+  RepoSummary *repoSummary = nullptr;
+
+  FetchJob jobs[3];
+  size_t jobCount = 0;
+
+  if (planner.shouldFetch(DataSource::Profile))
+  {
+    jobs[jobCount].name = "profile";
+    jobs[jobCount].run = fetchProfile;
+    jobs[jobCount].context = &fetchedProfile;
+    jobCount++;
+  }
+
+  if (planner.shouldFetch(DataSource::Calendar))
+  {
+    jobs[jobCount].name = "calendar";
+    jobs[jobCount].run = fetchStatistics;
+    jobs[jobCount].context = &statisticsJob;
+    jobCount++;
+  }
+
+  // Started last, the scan pages through all repositories
+  if (planner.shouldFetch(DataSource::Repos))
+  {
+    jobs[jobCount].name = "repos";
+    jobs[jobCount].run = fetchRepos;
+    jobs[jobCount].context = &repoSummary;
+    jobCount++;
+  }
+
+  RequestExecutor executor;
+  executor.run(jobs, jobCount);
+
+  if (fetchedProfile != nullptr)
+  {
+    // The REST profile has no stars, they come from the repository scan
+    fetchedProfile->stars = cachedProfile.stars;
+    cachedProfile = *fetchedProfile;
+    planner.markFetched(DataSource::Profile, now);
+  }
+
+  if (repoSummary != nullptr)
+  {
+    repoSummary->print();
+    cachedProfile.stars = repoSummary->stars();
+    planner.markFetched(DataSource::Repos, now);
+  }
+
+  if (statisticsJob.result != nullptr)
+  {
+    GitHubStats &fetched = *statisticsJob.result;
+    const int32_t today = context.today;
+
+    StatisticsEngine::update(cachedStats, fetched, today);
+    StatisticsEngine::fill(fetched, context.weekday);
+
+    SleepScheduler::recordCalendar(memcmp(&cachedStats, &fetched, sizeof(GitHubStats)) != 0);
+    cachedStats = fetched;
+    planner.markFetched(DataSource::Calendar, now);
+
+    HistoryStore::store(cachedStats, today);
+  }
+
+  if (statisticsJob.team != nullptr)
+  {
+    TeamMember *team = statisticsJob.team;
+    team[0].stats = cachedStats;
+    for (uint8_t i = 1; i < TeamConfig::UserCount; i++)
+      StatisticsEngine::evaluate(team[i].stats, context.today, context.weekday);
+
+    TeamStore::store(team, TeamConfig::UserCount);
+  }
+}
+
+/**
+ * Pick the next view of the team rotation, stored members and the team
+ * aggregate live in the wake arena
+ * @param stats Calendar to draw, left unchanged for GITHUB_USERNAME
+ * @param profile Profile to draw, left unchanged for GITHUB_USERNAME
+ */
+void selectView(const WakeContext &context, const GitHubStats *&stats, const GitHubProfile *&profile)
+{
+  const uint8_t view = TeamStore::next();
+
+  if (TeamStore::isAggregate(view))
+  {
+    TeamAggregate *aggregate = Arena::wake().create<TeamAggregate>();
+    if (aggregate != nullptr && aggregate->build(context.today, context.weekday))
+    {
+      aggregate->print(context.today);
+      stats = &aggregate->stats();
+      profile = &aggregate->profile();
+    }
+  }
+  else if (view > 0)
+  {
+    TeamMember *member = Arena::wake().create<TeamMember>();
+    if (member != nullptr && TeamStore::load(view, *member))
+    {
+      stats = &member->stats;
+      profile = &member->profile;
+    }
+  }
+}
 
 /**
  * Put the ESP32 into deep sleep mode to save power
- * Wakes up after 1 hour to refresh the display
+ * Wakes up at the next full hour or just after midnight, later overnight,
+ * while the calendar does not change or when the battery or the API rate
+ * limit runs low
  */
 void goDeepSleep()
 {
   renderer.hibernate();
-  // Go to deep sleep for 1 hour (3.6e9 microseconds = 3,600,000,000 µs)
-  esp_sleep_enable_timer_wakeup(TimeConfig::SleepTime);
+  profiler.mark("display");
+  profiler.print();
+  Arena::wake().reset();
+
+  const time_t now = time(nullptr);
+  const uint64_t scheduled = scheduler.sleepDurationUs(now);
+  scheduler.print();
+
+  const uint64_t stretched = RateLimit::adjustSleep(Battery::adjustSleep(scheduled), now);
+  const uint64_t sleepTime = scheduler.limitToMidnight(stretched);
+  Battery::recordWake(millis(), WiFiManager::radioOnTime(), sleepTime);
+
+  esp_sleep_enable_timer_wakeup(sleepTime);
   Serial.println("ESP goes to deep sleep now");
   Serial.flush();
   esp_deep_sleep_start();
@@ -56,28 +259,54 @@ void setup()
 {
   Serial.begin(115200);
 
+  // Reserve the memory of this wake while the heap is still in one piece
+  Arena::wake().begin(MemoryConfig::ArenaSize);
+
   renderer.init(0, GxEPD_BLACK);
 
+  // Measure before the radio adds load and noise
+  Battery::measure(time(nullptr));
+
+  profiler.mark("init");
+
   if (!wifimg.init())
   {
+    wifimg.shutdown();
     renderer.drawConnectionError();
     goDeepSleep();
   }
 
-  deviceInformation.WiFi_Strength = wifimg.RSSI();
-  deviceInformation.WiFi_Description = wifimg.getWiFidesc();
+  profiler.mark("wifi");
+  MemoryTelemetry::sample(Checkpoint::WiFi);
 
   tm.begin();
+  profiler.mark("time");
+
+  // Capture time and device state once, everything below works on this snapshot
+  wakeContext.device.WiFi_Strength = wifimg.RSSI();
+  wakeContext.device.WiFi_Description = wifimg.getWiFidesc();
+  wakeContext.device.battery = Battery::percent();
+  wakeContext.device.charging = Battery::isCharging();
+  tm.capture(wakeContext);
+  const WakeContext &context = wakeContext;
+
+  Serial.println(context.timeString);
+  fetchData(context);
+  profiler.mark("fetch");
+
+  RollingStatistics rolling;
+  if (rolling.build(cachedStats, context.today))
+    rolling.print(context.today);
 
-  // Format and display current time
-  Serial.println(tm.getFormattedDateTime());
-  strcpy(deviceInformation.time_string, tm.getFormattedDateTime().c_str());
-  deviceInformation.weekday = tm.getWeekday();
-  profile = ghParser.getProfile();
-  stats = ghParser.getStatistics(deviceInformation.weekday);
+  // All network results are in, render and refresh the panel with the radio off
+  wifimg.shutdown();
 
-  // Draw the GitHub Dashboard
-  renderer.drawDashboard(stats, profile, deviceInformation);
+  // Draw the GitHub Dashboard, of the next team member when rotating
+  const GitHubStats *stats = &cachedStats;
+  const GitHubProfile *profile = &cachedProfile;
+  selectView(context, stats, profile);
+  renderer.drawDashboard(stats, profile, context);
+  MemoryTelemetry::sample(Checkpoint::Render);
 
   // Enter deep sleep to conserve power until next update
   goDeepSleep();
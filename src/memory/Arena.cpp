@@ -0,0 +1,234 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Bump allocator reserved once at boot that holds everything
+ *              allocated during one wake, plus an ArduinoJson allocator on
+ *              top of it. Memory is released all at once with reset().
+ */
+
+#include "Arena.h"
+
+#include <stdarg.h>
+
+/**
+ * Reserve the memory of the arena, should be called early in the wake while
+ * the heap is still in one piece
+ * @param capacity Size in bytes
+ * @return false if the memory could not be reserved
+ */
+bool Arena::begin(const size_t capacity)
+{
+    _memory = static_cast<uint8_t *>(malloc(capacity));
+    _capacity = _memory != nullptr ? capacity : 0;
+    reset();
+
+    if (_memory == nullptr)
+        Serial.printf("[Arena] Unable to reserve %u bytes\n", (unsigned)capacity);
+
+    return _memory != nullptr;
+}
+
+/**
+ * Allocate a block, aligned to 8 bytes
+ * A released block that is large enough is reused before the arena grows.
+ * @param size Size in bytes
+ * @return nullptr if the arena is exhausted
+ */
+void *Arena::allocate(const size_t size)
+{
+    const size_t block = blockSize(size);
+    const size_t needed = sizeof(Header) + block;
+
+    portENTER_CRITICAL(&_lock);
+    void *reused = reuse(size);
+    if (reused != nullptr)
+    {
+        _allocations++;
+        portEXIT_CRITICAL(&_lock);
+        return reused;
+    }
+
+    if (_capacity - _used < needed)
+    {
+        _failures++;
+        portEXIT_CRITICAL(&_lock);
+        return nullptr;
+    }
+
+    Header *created = header(_used);
+    created->size = size;
+    created->capacity = block;
+    _last = _used;
+    _used += needed;
+    _allocations++;
+    if (_used > _highWater)
+        _highWater = _used;
+    portEXIT_CRITICAL(&_lock);
+
+    return created + 1;
+}
+
+/**
+ * Resize a block
+ * The most recent block grows and shrinks in place, any other one is
+ * moved to a new block when it grows and its old space is released.
+ * @param pointer Block from allocate(), or nullptr
+ * @param size New size in bytes
+ * @return nullptr if the arena is exhausted, the old block stays valid then
+ */
+void *Arena::reallocate(void *pointer, const size_t size)
+{
+    if (pointer == nullptr)
+        return allocate(size);
+
+    Header *resized = static_cast<Header *>(pointer) - 1;
+    const size_t offset = reinterpret_cast<uint8_t *>(resized) - _memory;
+    const size_t block = blockSize(size);
+
+    portENTER_CRITICAL(&_lock);
+    if (offset == _last && _capacity - offset >= sizeof(Header) + block)
+    {
+        resized->size = size;
+        resized->capacity = block;
+        _used = offset + sizeof(Header) + block;
+        if (_used > _highWater)
+            _highWater = _used;
+        portEXIT_CRITICAL(&_lock);
+        return pointer;
+    }
+
+    const size_t oldSize = resized->size;
+    if (block <= resized->capacity)
+    {
+        resized->size = size;
+        portEXIT_CRITICAL(&_lock);
+        return pointer;
+    }
+    portEXIT_CRITICAL(&_lock);
+
+    void *moved = allocate(size);
+    if (moved == nullptr)
+        return nullptr;
+
+    memcpy(moved, pointer, oldSize);
+    release(pointer);
+    return moved;
+}
+
+/**
+ * Give a block back before the end of the wake
+ * The most recent block is returned to the arena, any other one is kept
+ * for reuse by allocate().
+ * @param pointer Block from allocate(), or nullptr
+ */
+void Arena::release(void *pointer)
+{
+    if (pointer == nullptr)
+        return;
+
+    const size_t offset = reinterpret_cast<uint8_t *>(static_cast<Header *>(pointer) - 1) - _memory;
+
+    portENTER_CRITICAL(&_lock);
+    releaseLocked(offset);
+    portEXIT_CRITICAL(&_lock);
+}
+
+/**
+ * Take the first released block that fits, the lock must be held
+ * @param size Size in bytes
+ * @return nullptr if no released block is large enough
+ */
+void *Arena::reuse(const size_t size)
+{
+    const size_t block = blockSize(size);
+    size_t *link = &_free;
+
+    while (*link != NoBlock)
+    {
+        Header *candidate = header(*link);
+        size_t *next = reinterpret_cast<size_t *>(candidate + 1);
+
+        if (candidate->capacity >= block)
+        {
+            *link = *next;
+            _released -= candidate->capacity;
+            candidate->size = size;
+            return candidate + 1;
+        }
+
+        link = next;
+    }
+
+    return nullptr;
+}
+
+void Arena::releaseLocked(const size_t offset)
+{
+    Header *released = header(offset);
+
+    if (offset == _last)
+    {
+        _used = offset;
+        _last = NoBlock;
+        return;
+    }
+
+    *reinterpret_cast<size_t *>(released + 1) = _free;
+    _free = offset;
+    _released += released->capacity;
+}
+
+/**
+ * Format a string into the arena, e.g. for texts drawn on the display
+ * @return An empty string if the arena is exhausted
+ */
+char *Arena::printf(const char *format, ...)
+{
+    static char empty[1] = "";
+
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(nullptr, 0, format, args);
+    va_end(args);
+
+    char *text = length >= 0 ? static_cast<char *>(allocate(length + 1)) : nullptr;
+    if (text == nullptr)
+        return empty;
+
+    va_start(args, format);
+    vsnprintf(text, length + 1, format, args);
+    va_end(args);
+
+    return text;
+}
+
+/**
+ * Release everything at once, nothing allocated before may be used afterwards
+ */
+void Arena::reset()
+{
+    portENTER_CRITICAL(&_lock);
+    if (_highWater > highWaterEver)
+        highWaterEver = _highWater;
+    _used = 0;
+    _last = NoBlock;
+    _free = NoBlock;
+    _released = 0;
+    portEXIT_CRITICAL(&_lock);
+}
+
+void Arena::print() const
+{
+    const uint32_t highest = _highWater > highWaterEver ? _highWater : highWaterEver;
+    Serial.printf("[Profiler] arena: %u of %u bytes used at most, %u released for reuse, %lu allocations, "
+                  "%lu failed (highest ever %lu)\n",
+                  (unsigned)_highWater, (unsigned)_capacity, (unsigned)_released, (unsigned long)_allocations,
+                  (unsigned long)_failures, (unsigned long)highest);
+}
+
+Arena &Arena::wake()
+{
+    static Arena arena;
+    return arena;
+}
@@ -0,0 +1,102 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Bump allocator reserved once at boot that holds everything
+ *              allocated during one wake, plus an ArduinoJson allocator on
+ *              top of it. Memory is released all at once with reset(),
+ *              blocks freed before are reused by later allocations.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <new>
+
+#include "config/memoryConfig.h"
+
+class Arena
+{
+public:
+    bool begin(const size_t capacity);
+    void *allocate(const size_t size);
+    void *reallocate(void *pointer, const size_t size);
+    void release(void *pointer);
+    char *printf(const char *format, ...);
+    void reset();
+    void print() const;
+
+    size_t used() const { return _used; }
+    size_t released() const { return _released; }
+    size_t highWater() const { return _highWater; }
+    size_t capacity() const { return _capacity; }
+
+    template <typename T>
+    T *create()
+    {
+        void *memory = allocate(sizeof(T));
+        return memory != nullptr ? new (memory) T() : nullptr;
+    }
+
+    template <typename T>
+    T *createArray(const size_t count)
+    {
+        T *array = static_cast<T *>(allocate(sizeof(T) * count));
+        for (size_t i = 0; array != nullptr && i < count; i++)
+            new (&array[i]) T();
+        return array;
+    }
+
+    // Arena of the current wake, shared by all tasks
+    static Arena &wake();
+
+private:
+    // Every block starts with its size so it can be grown or copied, and
+    // the space reserved for it so it can be reused once released
+    struct Header
+    {
+        size_t size;
+        size_t capacity;
+    };
+
+    static constexpr size_t Alignment = 8;
+    static constexpr size_t NoBlock = SIZE_MAX;
+
+    static size_t align(const size_t size) { return (size + Alignment - 1) & ~(Alignment - 1); }
+    // Released blocks hold the offset of the next one, so none is smaller than that
+    static size_t blockSize(const size_t size) { return align(size > sizeof(size_t) ? size : sizeof(size_t)); }
+
+    Header *header(const size_t offset) const { return reinterpret_cast<Header *>(_memory + offset); }
+    void *reuse(const size_t size);
+    void releaseLocked(const size_t offset);
+
+    uint8_t *_memory = nullptr;
+    size_t _capacity = 0;
+    size_t _used = 0;
+    size_t _last = NoBlock;
+    // Released blocks, linked through their first bytes
+    size_t _free = NoBlock;
+    size_t _released = 0;
+    size_t _highWater = 0;
+    uint32_t _allocations = 0;
+    uint32_t _failures = 0;
+    portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+
+    inline static RTC_DATA_ATTR uint32_t highWaterEver = 0;
+};
+
+// Lets JsonDocument allocate from the wake arena
+class ArenaAllocator : public ArduinoJson::Allocator
+{
+public:
+    void *allocate(size_t size) override { return Arena::wake().allocate(size); }
+    void deallocate(void *pointer) override { Arena::wake().release(pointer); }
+    void *reallocate(void *pointer, size_t size) override { return Arena::wake().reallocate(pointer, size); }
+
+    static ArenaAllocator *instance()
+    {
+        static ArenaAllocator allocator;
+        return &allocator;
+    }
+};
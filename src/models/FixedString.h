@@ -0,0 +1,74 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: String with a fixed capacity stored inline, so models that use
+ *              it stay trivial and can be kept in RTC memory, hashed or
+ *              compared with memcmp.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+#include <type_traits>
+
+/**
+ * Null terminated string of at most Size - 1 bytes
+ * Longer values are truncated without splitting a UTF-8 sequence. Unused
+ * bytes are always zero, equal strings are equal byte for byte.
+ * There is deliberately no default member initializer: a constructor would
+ * make RTC_DATA_ATTR models dynamically initialized, which wipes them on
+ * every wake. Statics start zeroed, other instances need {} or new T().
+ */
+template <size_t Size>
+class FixedString
+{
+public:
+    static_assert(Size > 1, "FixedString needs room for at least one character");
+
+    FixedString &operator=(const char *value)
+    {
+        assign(value);
+        return *this;
+    }
+
+    void assign(const char *value)
+    {
+        // Scan up to the terminator or one byte past the capacity, whichever
+        // comes first. A literal shorter than Size is never read beyond its end.
+        size_t length = 0;
+        if (value != nullptr)
+        {
+            while (length < Size && value[length] != '\0')
+                length++;
+        }
+
+        if (length == Size)
+        {
+            // Truncate, and step back over continuation bytes of a cut sequence
+            length = Size - 1;
+            while (length > 0 && (static_cast<unsigned char>(value[length]) & 0xC0) == 0x80)
+                length--;
+        }
+
+        if (length > 0)
+            memcpy(_data, value, length);
+        memset(_data + length, 0, Size - length);
+    }
+
+    const char *c_str() const { return _data; }
+    size_t length() const { return strlen(_data); }
+    bool empty() const { return _data[0] == '\0'; }
+    static constexpr size_t capacity() { return Size - 1; }
+
+    bool operator==(const char *other) const { return other != nullptr && strcmp(_data, other) == 0; }
+    bool operator!=(const char *other) const { return !(*this == other); }
+
+private:
+    char _data[Size];
+};
+
+static_assert(std::is_trivially_copyable<FixedString<8>>::value, "FixedString must stay trivially copyable");
+static_assert(std::is_trivially_default_constructible<FixedString<8>>::value,
+              "FixedString must not need a constructor, see above");
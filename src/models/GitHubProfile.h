@@ -8,24 +8,28 @@
 #pragma once
 
 #include <Arduino.h>
+#include <type_traits>
 
+#include "FixedString.h"
+
+// Sizes follow the limits of GitHub, texts may need several bytes per character
 struct GitHubProfile
 {
-    String username;
-    String name;
-    String bio;
-    String blog;
-    String twitterUsername;
-    String email;
-    String company;
-    String* followerList;
-    String* followingList;
-    String* repos;
-    String* starredRepos;
+    FixedString<40> username;
+    FixedString<128> name;
+    FixedString<256> bio;
+    FixedString<128> blog;
+    FixedString<16> twitterUsername;
+    FixedString<96> email;
+    FixedString<64> company;
     int publicRepos;
     int publicGists;
     int followers;
     int following;
     int stars;
     int starred;
-};
\ No newline at end of file
+};
+
+// Kept in RTC memory, a constructor would reset it on every wake
+static_assert(std::is_trivially_default_constructible<GitHubProfile>::value,
+              "GitHubProfile must be trivially default constructible");
@@ -9,12 +9,14 @@
 
 #include <Arduino.h>
 
+#include "FixedString.h"
+
 struct GitHubRepo
 {
-    String name;
-    String description;
-    String language;
-    String license;
+    FixedString<101> name;
+    FixedString<256> description;
+    FixedString<32> language;
+    FixedString<32> license;
     int stargazers;
     int watchers;
-};
\ No newline at end of file
+};
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <stdint.h>
+#include <type_traits>
+
 struct GitHubStats
 {
     int contributions;
@@ -14,5 +17,13 @@ struct GitHubStats
     int currentStreak;
     int maxContributions;
     float averageContributions;
-    uint8_t commits[372];
-};
\ No newline at end of file
+    // Day of commits[0] counted since 1970-01-01, always a Sunday
+    int32_t startDay;
+    // First day of the requested range, the entries before it are zero
+    int32_t firstDay;
+    uint16_t commits[372];
+};
+
+// Kept in RTC memory, a constructor would reset it on every wake
+static_assert(std::is_trivially_default_constructible<GitHubStats>::value,
+              "GitHubStats must be trivially default constructible");
\ No newline at end of file
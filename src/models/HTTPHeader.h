@@ -4,15 +4,13 @@
  * License: MIT
  * Description: Represents a single HTTP header (key/value pair) used when
  *              sending or parsing HTTP requests and responses. This lightweight
- *              struct is intended for use with Arduino/ESP32 networking
- *              utilities within the project.
+ *              struct only references its strings so it can be shared by the
+ *              ESP32 and POSIX transports.
  */
 
 #pragma once
 
-#include <Arduino.h>
-
 struct HTTPHeader {
-    String key;
-    String value;
-};
\ No newline at end of file
+    const char *key;
+    const char *value;
+};
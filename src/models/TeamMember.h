@@ -0,0 +1,18 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Profile and contribution calendar of one user of the team
+ */
+
+#pragma once
+
+#include "GitHubProfile.h"
+#include "GitHubStats.h"
+
+struct TeamMember
+{
+    bool valid; // Set once the calendar of the user was received
+    GitHubProfile profile;
+    GitHubStats stats;
+};
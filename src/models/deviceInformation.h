@@ -2,18 +2,20 @@
  * Created on: 2026-07-22
  * Author(s): Toni Fey
  * License: MIT
- * Description: Device information model for battery, WiFi, and time data
+ * Description: Device information model for battery and WiFi data
  */
 
 #pragma once
 
 #include <Arduino.h>
 
+#include "FixedString.h"
+
 struct DeviceInformation
 {
+    // Charge in percent, -1 without a battery
     float battery = -1;
+    bool charging = false;
     int8_t WiFi_Strength;
-    String WiFi_Description;
-    char time_string[64];
-    int weekday = 0;
-};
\ No newline at end of file
+    FixedString<24> WiFi_Description;
+};
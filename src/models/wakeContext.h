@@ -0,0 +1,30 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Snapshot of time and device state captured once per wake and
+ *              shared by the client, the parser and the renderer, so all of
+ *              them see the same day even when a wake straddles midnight.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "deviceInformation.h"
+
+struct WakeContext
+{
+    time_t now = 0;
+    tm local = {};
+    uint8_t weekday = 0;
+    int32_t today = 0; // Local day since 1970-01-01
+    char timeString[24] = "";
+
+    // Range of the contribution calendar query, from the Sunday TimeConfig::CalendarWeeks before this week until today
+    tm rangeFrom = {};
+    tm rangeTo = {};
+
+    DeviceInformation device;
+};
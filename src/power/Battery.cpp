@@ -0,0 +1,204 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Battery measurement with a history in RTC memory, the update
+ *              interval policy and a runtime estimate from the energy used
+ *              per wake.
+ */
+
+#include "Battery.h"
+
+/**
+ * Measure the battery and add the result to the history
+ * Should run before WiFi starts, the radio adds noise and load.
+ * @param now Current epoch, may be unset this early in the wake
+ */
+void Battery::measure(const time_t now)
+{
+    mv = readMillivolts();
+
+    if (mv < PowerConfig::NoBatteryMv)
+    {
+        level = -1;
+        charging = false;
+        return;
+    }
+
+    // Charging starts with a rise since the last wake and lasts until the
+    // voltage drops below the peak reached meanwhile
+    if (charging)
+    {
+        if (mv > chargingPeakMv)
+            chargingPeakMv = mv;
+        else if (mv + PowerConfig::ChargingDropMv <= chargingPeakMv)
+            charging = false;
+    }
+    else if (historyCount > 0)
+    {
+        const Sample &last = history[(historyNext + HistoryLength - 1) % HistoryLength];
+        charging = mv >= last.mv + PowerConfig::ChargingRiseMv;
+        chargingPeakMv = mv;
+    }
+
+    history[historyNext] = {now, mv};
+    historyNext = (historyNext + 1) % HistoryLength;
+    if (historyCount < HistoryLength)
+        historyCount++;
+
+    level = toPercent(mv);
+}
+
+bool Battery::isPresent()
+{
+    return level >= 0;
+}
+
+bool Battery::isCharging()
+{
+    return charging;
+}
+
+bool Battery::isLow()
+{
+    return isPresent() && !charging && level < PowerConfig::LowPercent;
+}
+
+bool Battery::isCritical()
+{
+    return isPresent() && !charging && level < PowerConfig::CriticalPercent;
+}
+
+int8_t Battery::percent()
+{
+    return level;
+}
+
+uint16_t Battery::millivolts()
+{
+    return mv;
+}
+
+/**
+ * Space the wakes further apart as the charge drops
+ * @param sleepUs Planned sleep duration in microseconds
+ * @return Sleep duration to use in microseconds
+ */
+uint64_t Battery::adjustSleep(const uint64_t sleepUs)
+{
+    uint8_t factor = 1;
+    if (isCritical())
+        factor = PowerConfig::CriticalIntervalFactor;
+    else if (isLow())
+        factor = PowerConfig::LowIntervalFactor;
+
+    if (factor > 1)
+        Serial.printf("[Battery] %d%% left, sleeping %u times longer\n", level, factor);
+
+    return sleepUs * factor;
+}
+
+/**
+ * Update the energy model with the durations of this wake
+ * @param awakeMs Time from boot to deep sleep
+ * @param radioOnMs Part of it with WiFi on
+ * @param sleepUs Deep sleep that follows
+ */
+void Battery::recordWake(const uint32_t awakeMs, const uint32_t radioOnMs, const uint64_t sleepUs)
+{
+    const uint32_t activeMs = awakeMs > radioOnMs ? awakeMs - radioOnMs : 0;
+    const float sleepSeconds = sleepUs / 1e6f;
+
+    // mA * ms / 3600 = µAh, µA * s / 3600 = µAh
+    const float chargeUah = (PowerConfig::RadioOnMa * radioOnMs + PowerConfig::ActiveMa * activeMs) / 3600.0f +
+                            PowerConfig::DeepSleepUa * sleepSeconds / 3600.0f;
+    const float seconds = awakeMs / 1000.0f + sleepSeconds;
+
+    if (wakeChargeUah == 0)
+    {
+        wakeChargeUah = chargeUah;
+        cycleSeconds = seconds;
+    }
+    else
+    {
+        wakeChargeUah = wakeChargeUah * 0.75f + chargeUah * 0.25f;
+        cycleSeconds = cycleSeconds * 0.75f + seconds * 0.25f;
+    }
+}
+
+void Battery::print()
+{
+    if (!isPresent())
+    {
+        Serial.printf("[Profiler] battery: not connected (%u mV)\n", mv);
+        return;
+    }
+
+    // Remaining charge divided by the average charge per wake cycle
+    float hours = 0;
+    if (wakeChargeUah > 0)
+    {
+        const float remainingUah = PowerConfig::CapacityMah * 1000.0f * level / 100.0f;
+        hours = remainingUah / wakeChargeUah * cycleSeconds / 3600.0f;
+    }
+
+    uint16_t oldest = mv;
+    if (historyCount > 0)
+        oldest = history[(historyNext + HistoryLength - historyCount) % HistoryLength].mv;
+
+    Serial.printf("[Profiler] battery: %u mV, %d%%%s, %.0f uAh per wake, ~%.0f h left (%+d mV over %u wakes)\n",
+                  mv, level, charging ? " charging" : "", wakeChargeUah, hours,
+                  (int)mv - (int)oldest, historyCount);
+}
+
+/**
+ * Oversampled battery voltage, the eFuse calibration is applied by the ADC driver
+ * @return Battery voltage in millivolts
+ */
+uint16_t Battery::readMillivolts()
+{
+    uint32_t sum = 0;
+    uint16_t lowest = UINT16_MAX;
+    uint16_t highest = 0;
+
+    for (uint8_t i = 0; i < PowerConfig::Samples; i++)
+    {
+        const uint16_t sample = analogReadMilliVolts(Pins::Battery);
+        sum += sample;
+        if (sample < lowest)
+            lowest = sample;
+        if (sample > highest)
+            highest = sample;
+    }
+
+    // Drop the outliers on both ends
+    sum -= lowest + highest;
+    const float adc = (float)sum / (PowerConfig::Samples - 2);
+
+    return (uint16_t)(adc * PowerConfig::DividerRatio + 0.5f);
+}
+
+/**
+ * Charge in percent, interpolated linearly between the points of the discharge curve
+ * @param mv Battery voltage in millivolts
+ */
+uint8_t Battery::toPercent(const uint16_t mv)
+{
+    const PowerConfig::CurvePoint *curve = PowerConfig::DischargeCurve;
+    const size_t points = sizeof(PowerConfig::DischargeCurve) / sizeof(PowerConfig::DischargeCurve[0]);
+
+    if (mv >= curve[0].mv)
+        return curve[0].percent;
+
+    for (size_t i = 1; i < points; i++)
+    {
+        if (mv >= curve[i].mv)
+        {
+            const uint16_t span = curve[i - 1].mv - curve[i].mv;
+            const uint8_t range = curve[i - 1].percent - curve[i].percent;
+            return curve[i].percent + (uint32_t)(mv - curve[i].mv) * range / span;
+        }
+    }
+
+    return 0;
+}
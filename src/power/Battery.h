@@ -0,0 +1,59 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Battery measurement with a history in RTC memory, the update
+ *              interval policy and a runtime estimate from the energy used
+ *              per wake.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "config/pins.h"
+#include "config/powerConfig.h"
+
+class Battery
+{
+public:
+    static void measure(const time_t now);
+    static bool isPresent();
+    static bool isCharging();
+    static bool isLow();
+    static bool isCritical();
+    static int8_t percent();
+    static uint16_t millivolts();
+
+    static uint64_t adjustSleep(const uint64_t sleepUs);
+    static void recordWake(const uint32_t awakeMs, const uint32_t radioOnMs, const uint64_t sleepUs);
+    static void print();
+
+private:
+    static constexpr uint8_t HistoryLength = 24;
+
+    struct Sample
+    {
+        time_t time;
+        uint16_t mv;
+    };
+
+    static uint16_t readMillivolts();
+    static uint8_t toPercent(const uint16_t mv);
+
+    inline static uint16_t mv = 0;
+    inline static int8_t level = -1;
+
+    // Charging state with hysteresis, kept across wakes
+    inline static RTC_DATA_ATTR bool charging = false;
+    inline static RTC_DATA_ATTR uint16_t chargingPeakMv = 0;
+
+    inline static RTC_DATA_ATTR Sample history[HistoryLength] = {};
+    inline static RTC_DATA_ATTR uint8_t historyCount = 0;
+    inline static RTC_DATA_ATTR uint8_t historyNext = 0;
+
+    // Exponential averages of the charge per wake in µAh and of the wake cycle in seconds
+    inline static RTC_DATA_ATTR float wakeChargeUah = 0;
+    inline static RTC_DATA_ATTR float cycleSeconds = 0;
+};
@@ -0,0 +1,114 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Samples free heap, the largest free block and the stack high
+ *              water mark at the checkpoints of a wake, keeps the lowest
+ *              values across wakes and checks them against a budget.
+ */
+
+#include "MemoryTelemetry.h"
+
+/**
+ * Sample the heap and the stack of the calling task
+ * Checkpoints reached by several tasks, like TLS and Parse for parallel
+ * requests, keep the lowest values.
+ * @param checkpoint Checkpoint that was just reached
+ */
+void MemoryTelemetry::sample(const Checkpoint checkpoint)
+{
+    const MemorySample sample = {ESP.getFreeHeap(), ESP.getMaxAllocHeap(), uxTaskGetStackHighWaterMark(nullptr)};
+    const uint8_t index = static_cast<uint8_t>(checkpoint);
+
+    portENTER_CRITICAL(&lock);
+    if (sampled[index])
+        keepLowest(current[index], sample);
+    else
+        current[index] = sample;
+    sampled[index] = true;
+
+    if (lowestValid[index])
+        keepLowest(lowest[index], sample);
+    else
+        lowest[index] = sample;
+    lowestValid[index] = true;
+    portEXIT_CRITICAL(&lock);
+
+    check(checkpoint, sample);
+}
+
+/**
+ * Compare a sample with the budget of MemoryConfig
+ * Kept separate from sample() so the budget can be checked with made up values.
+ * @param checkpoint Checkpoint the sample belongs to
+ * @param sample Values to check
+ */
+void MemoryTelemetry::check(const Checkpoint checkpoint, const MemorySample &sample)
+{
+    const bool heap = sample.freeHeap < MemoryConfig::MinFreeHeap;
+    const bool block = sample.largestBlock < MemoryConfig::MinLargestBlock;
+    const bool stack = sample.stackFree < MemoryConfig::MinStackFree;
+
+    if (!heap && !block && !stack)
+        return;
+
+    exceeded = true;
+    Serial.printf("[Memory] Budget exceeded after %s:%s%s%s\n", name(checkpoint),
+                  heap ? " free heap" : "", block ? " largest block" : "", stack ? " stack" : "");
+}
+
+/**
+ * @return false if any checkpoint of this wake was below its budget
+ */
+bool MemoryTelemetry::withinBudget()
+{
+    return !exceeded;
+}
+
+void MemoryTelemetry::print()
+{
+    Serial.printf("[Profiler] memory: lowest free heap %lu bytes this boot, budget %s\n",
+                  (unsigned long)esp_get_minimum_free_heap_size(), withinBudget() ? "kept" : "exceeded");
+
+    for (uint8_t i = 0; i < CheckpointCount; i++)
+    {
+        if (!sampled[i])
+            continue;
+
+        const MemorySample &sample = current[i];
+        const uint32_t fragmentation = sample.freeHeap > 0 ? 100 - sample.largestBlock * 100 / sample.freeHeap : 0;
+        Serial.printf("[Profiler] memory %-7s heap %6lu, block %6lu (%2lu%% fragmented), stack %5lu | lowest ever %6lu, %6lu, %5lu\n",
+                      name(static_cast<Checkpoint>(i)),
+                      (unsigned long)sample.freeHeap, (unsigned long)sample.largestBlock,
+                      (unsigned long)fragmentation, (unsigned long)sample.stackFree,
+                      (unsigned long)lowest[i].freeHeap, (unsigned long)lowest[i].largestBlock,
+                      (unsigned long)lowest[i].stackFree);
+    }
+}
+
+const char *MemoryTelemetry::name(const Checkpoint checkpoint)
+{
+    switch (checkpoint)
+    {
+    case Checkpoint::WiFi:
+        return "wifi";
+    case Checkpoint::TLS:
+        return "tls";
+    case Checkpoint::Parse:
+        return "parse";
+    case Checkpoint::Render:
+        return "render";
+    default:
+        return "unknown";
+    }
+}
+
+void MemoryTelemetry::keepLowest(MemorySample &into, const MemorySample &sample)
+{
+    if (sample.freeHeap < into.freeHeap)
+        into.freeHeap = sample.freeHeap;
+    if (sample.largestBlock < into.largestBlock)
+        into.largestBlock = sample.largestBlock;
+    if (sample.stackFree < into.stackFree)
+        into.stackFree = sample.stackFree;
+}
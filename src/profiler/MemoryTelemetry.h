@@ -0,0 +1,54 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Samples free heap, the largest free block and the stack high
+ *              water mark at the checkpoints of a wake, keeps the lowest
+ *              values across wakes and checks them against a budget.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "config/memoryConfig.h"
+
+enum class Checkpoint : uint8_t
+{
+    WiFi,
+    TLS,
+    Parse,
+    Render,
+    Count
+};
+
+struct MemorySample
+{
+    uint32_t freeHeap;
+    uint32_t largestBlock;
+    uint32_t stackFree; // Bytes of the sampling task's stack never used
+};
+
+class MemoryTelemetry
+{
+public:
+    static void sample(const Checkpoint checkpoint);
+    static void check(const Checkpoint checkpoint, const MemorySample &sample);
+    static bool withinBudget();
+    static void print();
+
+private:
+    static constexpr uint8_t CheckpointCount = static_cast<uint8_t>(Checkpoint::Count);
+
+    static const char *name(const Checkpoint checkpoint);
+    static void keepLowest(MemorySample &into, const MemorySample &sample);
+
+    inline static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    inline static MemorySample current[CheckpointCount] = {};
+    inline static bool sampled[CheckpointCount] = {};
+    inline static bool exceeded = false;
+
+    // Lowest values of any wake
+    inline static RTC_DATA_ATTR MemorySample lowest[CheckpointCount] = {};
+    inline static RTC_DATA_ATTR bool lowestValid[CheckpointCount] = {};
+};
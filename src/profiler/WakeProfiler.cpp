@@ -0,0 +1,54 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Records how long each phase of a wake takes and prints a
+ *              summary, together with the API rate limits, before deep sleep.
+ */
+
+#include "WakeProfiler.h"
+
+#include "GitHub/RateLimit.h"
+#include "display/displayRenderer.h"
+#include "history/HistoryStore.h"
+#include "memory/Arena.h"
+#include "MemoryTelemetry.h"
+#include "power/Battery.h"
+#include "team/TeamStore.h"
+#include "WiFiManager/DNSCache.h"
+#include "WiFiManager/WiFiManager.h"
+
+/**
+ * Mark the end of a phase, its duration is measured from the previous mark
+ * or from boot for the first one
+ * @param phase Name of the phase that just finished
+ */
+void WakeProfiler::mark(const char *phase)
+{
+    if (_count < MaxPhases)
+        _phases[_count++] = {phase, millis()};
+}
+
+void WakeProfiler::print() const
+{
+    uint32_t previous = 0;
+
+    Serial.println("--------------------------------");
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        Serial.printf("[Profiler] %-10s %6lu ms\n", _phases[i].name, (unsigned long)(_phases[i].endMs - previous));
+        previous = _phases[i].endMs;
+    }
+    Serial.printf("[Profiler] %-10s %6lu ms\n", "total", (unsigned long)millis());
+
+    WiFiManager::printTiming();
+    DisplayRenderer::printTiming();
+    RateLimit::print(time(nullptr));
+    DNSCache::print();
+    Battery::print();
+    HistoryStore::print();
+    TeamStore::print();
+    Arena::wake().print();
+    MemoryTelemetry::print();
+    Serial.println("--------------------------------");
+}
@@ -0,0 +1,31 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Records how long each phase of a wake takes and prints a
+ *              summary, together with the API rate limits, before deep sleep.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+
+class WakeProfiler
+{
+public:
+    void mark(const char *phase);
+    void print() const;
+
+private:
+    static constexpr uint8_t MaxPhases = 12;
+
+    struct Phase
+    {
+        const char *name;
+        uint32_t endMs;
+    };
+
+    Phase _phases[MaxPhases];
+    uint8_t _count = 0;
+};
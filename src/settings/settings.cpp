@@ -7,6 +7,6 @@
  *              application.
  */
 
-#include "Settings.h"
+#include "settings.h"
 
 Language Settings::language = Language::English;
\ No newline at end of file
@@ -0,0 +1,121 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Totals over all repositories of a user, reduced while the
+ *              pages arrive: stars, forks, the most starred repositories in
+ *              a fixed size min-heap and the bytes per language.
+ */
+
+#include "RepoSummary.h"
+
+/**
+ * Count a repository, it is kept if it has more stars than the least
+ * starred of the kept ones
+ * @param repo Repository as received
+ * @param forks Number of forks of the repository
+ */
+void RepoSummary::add(const GitHubRepo &repo, const uint32_t forks)
+{
+    _repos++;
+    _stars += repo.stargazers;
+    _forks += forks;
+
+    if (_topCount < RepoConfig::TopRepos)
+    {
+        // Append and sift up
+        uint8_t index = _topCount++;
+        while (index > 0 && repo.stargazers < _top[(index - 1) / 2].stargazers)
+        {
+            _top[index] = _top[(index - 1) / 2];
+            index = (index - 1) / 2;
+        }
+        _top[index] = repo;
+    }
+    else if (repo.stargazers > _top[0].stargazers)
+    {
+        _top[0] = repo;
+        siftDown(0, _topCount);
+    }
+}
+
+/**
+ * Add the bytes of one language of a repository
+ */
+void RepoSummary::addLanguage(const char *name, const uint32_t bytes)
+{
+    for (uint8_t i = 0; i < _languageCount; i++)
+    {
+        if (_languages[i].name == name)
+        {
+            _languages[i].bytes += bytes;
+            return;
+        }
+    }
+
+    if (_languageCount < RepoConfig::MaxLanguages)
+    {
+        LanguageTotal &language = _languages[_languageCount++];
+        language.name = _languageCount < RepoConfig::MaxLanguages ? name : "Other";
+        language.bytes = bytes;
+    }
+    else
+    {
+        _languages[RepoConfig::MaxLanguages - 1].bytes += bytes;
+    }
+}
+
+/**
+ * Sort the kept repositories by stars and the languages by size, both descending
+ */
+void RepoSummary::finish()
+{
+    // Heap sort, the least starred repository moves to the back first
+    for (uint8_t end = _topCount; end > 1; end--)
+    {
+        const GitHubRepo least = _top[0];
+        _top[0] = _top[end - 1];
+        _top[end - 1] = least;
+        siftDown(0, end - 1);
+    }
+
+    for (uint8_t i = 1; i < _languageCount; i++)
+    {
+        const LanguageTotal language = _languages[i];
+        uint8_t j = i;
+        for (; j > 0 && _languages[j - 1].bytes < language.bytes; j--)
+            _languages[j] = _languages[j - 1];
+        _languages[j] = language;
+    }
+}
+
+void RepoSummary::print() const
+{
+    Serial.printf("[Repos] %lu repositories, %lu stars, %lu forks\n",
+                  (unsigned long)_repos, (unsigned long)_stars, (unsigned long)_forks);
+
+    for (uint8_t i = 0; i < _topCount; i++)
+        Serial.printf("[Repos] %s: %d stars\n", _top[i].name.c_str(), _top[i].stargazers);
+
+    for (uint8_t i = 0; i < _languageCount; i++)
+        Serial.printf("[Repos] %s: %llu bytes\n", _languages[i].name.c_str(), (unsigned long long)_languages[i].bytes);
+}
+
+void RepoSummary::siftDown(uint8_t index, const uint8_t count)
+{
+    const GitHubRepo repo = _top[index];
+
+    while (2 * index + 1 < count)
+    {
+        uint8_t child = 2 * index + 1;
+        if (child + 1 < count && _top[child + 1].stargazers < _top[child].stargazers)
+            child++;
+        if (repo.stargazers <= _top[child].stargazers)
+            break;
+
+        _top[index] = _top[child];
+        index = child;
+    }
+
+    _top[index] = repo;
+}
@@ -0,0 +1,57 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Totals over all repositories of a user, reduced while the
+ *              pages arrive: stars, forks, the most starred repositories in
+ *              a fixed size min-heap and the bytes per language.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "config/repoConfig.h"
+#include "models/FixedString.h"
+#include "models/GitHubRepo.h"
+
+struct LanguageTotal
+{
+    FixedString<32> name;
+    uint64_t bytes;
+};
+
+class RepoSummary
+{
+public:
+    void add(const GitHubRepo &repo, const uint32_t forks);
+    void addLanguage(const char *name, const uint32_t bytes);
+    void finish();
+    void print() const;
+
+    uint32_t repos() const { return _repos; }
+    uint32_t stars() const { return _stars; }
+    uint32_t forks() const { return _forks; }
+
+    // Most starred first once finished
+    const GitHubRepo *top() const { return _top; }
+    uint8_t topCount() const { return _topCount; }
+
+    // Largest first once finished
+    const LanguageTotal *languages() const { return _languages; }
+    uint8_t languageCount() const { return _languageCount; }
+
+private:
+    void siftDown(uint8_t index, const uint8_t count);
+
+    uint32_t _repos = 0;
+    uint32_t _stars = 0;
+    uint32_t _forks = 0;
+
+    // Min-heap on stargazers until finish() sorts it
+    GitHubRepo _top[RepoConfig::TopRepos] = {};
+    uint8_t _topCount = 0;
+
+    LanguageTotal _languages[RepoConfig::MaxLanguages] = {};
+    uint8_t _languageCount = 0;
+};
@@ -0,0 +1,172 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Prefix sums over the contribution calendar that answer the
+ *              sum, average and active days of any range, month or weekday
+ *              in constant time.
+ */
+
+#include "RollingStatistics.h"
+
+/**
+ * Build the prefix sums of consecutive days, the arrays live in the wake arena
+ * @param firstDay Day of counts[0] since 1970-01-01
+ * @param counts Contributions per day
+ * @param days Number of days
+ * @return false if the arena is exhausted
+ */
+bool RollingStatistics::build(const int32_t firstDay, const uint16_t *counts, const size_t days)
+{
+    Arena &arena = Arena::wake();
+    _sums = static_cast<uint32_t *>(arena.allocate((days + 1) * sizeof(uint32_t)));
+    _active = static_cast<uint16_t *>(arena.allocate((days + 1) * sizeof(uint16_t)));
+    _weekdaySums = static_cast<uint32_t *>(arena.allocate((days + 7) * sizeof(uint32_t)));
+    _weekdayActive = static_cast<uint16_t *>(arena.allocate((days + 7) * sizeof(uint16_t)));
+
+    if (_sums == nullptr || _active == nullptr || _weekdaySums == nullptr || _weekdayActive == nullptr)
+    {
+        _days = 0;
+        return false;
+    }
+
+    _firstDay = firstDay;
+    _days = days;
+
+    _sums[0] = 0;
+    _active[0] = 0;
+    for (uint8_t i = 0; i < 7; i++)
+    {
+        _weekdaySums[i] = 0;
+        _weekdayActive[i] = 0;
+    }
+
+    for (size_t i = 0; i < days; i++)
+    {
+        const bool active = counts[i] > 0;
+        _sums[i + 1] = _sums[i] + counts[i];
+        _active[i + 1] = _active[i] + active;
+        _weekdaySums[i + 7] = _weekdaySums[i] + counts[i];
+        _weekdayActive[i + 7] = _weekdayActive[i] + active;
+    }
+
+    return true;
+}
+
+/**
+ * Build the prefix sums of a fetched calendar, days after today are left out
+ * @param stats Calendar
+ * @param today Current day since 1970-01-01
+ * @return false if the arena is exhausted
+ */
+bool RollingStatistics::build(const GitHubStats &stats, const int32_t today)
+{
+    const int32_t capacity = sizeof(stats.commits) / sizeof(stats.commits[0]);
+    int32_t days = today - stats.startDay + 1;
+
+    if (days < 0)
+        days = 0;
+    else if (days > capacity)
+        days = capacity;
+
+    return build(stats.startDay, stats.commits, days);
+}
+
+/**
+ * Statistics of the days from..to, both included, limited to the known days
+ */
+RangeStatistics RollingStatistics::range(int32_t from, int32_t to) const
+{
+    if (!clamp(from, to))
+        return make(0, 0, 0);
+
+    const size_t first = from - _firstDay;
+    const size_t last = to - _firstDay;
+    return make(_sums[last + 1] - _sums[first], _active[last + 1] - _active[first], last - first + 1);
+}
+
+/**
+ * Statistics of the last days up to and including today
+ */
+RangeStatistics RollingStatistics::lastDays(const uint16_t days, const int32_t today) const
+{
+    return range(today - days + 1, today);
+}
+
+/**
+ * Statistics of a calendar month
+ * @param month Month 1-12
+ */
+RangeStatistics RollingStatistics::month(const int year, const int month) const
+{
+    const int32_t first = TimeUtils::daysFromCivil(year, month, 1);
+    const int32_t next = month == 12 ? TimeUtils::daysFromCivil(year + 1, 1, 1) : TimeUtils::daysFromCivil(year, month + 1, 1);
+    return range(first, next - 1);
+}
+
+/**
+ * Statistics of one weekday between two days, e.g. all Mondays of a year
+ * @param weekday Day of the week, 0 is Sunday
+ */
+RangeStatistics RollingStatistics::weekday(const uint8_t weekday, int32_t from, int32_t to) const
+{
+    if (!clamp(from, to))
+        return make(0, 0, 0);
+
+    // Indices of the first and the last matching day in the range
+    const int32_t first = from - _firstDay;
+    const int32_t last = to - _firstDay;
+    const int32_t residue = ((int32_t)weekday - weekdayOf(_firstDay) + 7) % 7;
+    const int32_t low = first + ((residue - first) % 7 + 7) % 7;
+    const int32_t high = last - ((last - residue) % 7 + 7) % 7;
+
+    if (low > high)
+        return make(0, 0, 0);
+
+    return make(_weekdaySums[high + 7] - _weekdaySums[low],
+                _weekdayActive[high + 7] - _weekdayActive[low],
+                (high - low) / 7 + 1);
+}
+
+/**
+ * Statistics of a week from Sunday to Saturday
+ * @param weeksAgo 0 for the current week, 1 for the one before and so on
+ */
+RangeStatistics RollingStatistics::week(const int32_t today, const int weeksAgo) const
+{
+    const int32_t sunday = today - weekdayOf(today) - 7 * weeksAgo;
+    return range(sunday, sunday + 6);
+}
+
+void RollingStatistics::print(const int32_t today) const
+{
+    Serial.printf("[Stats] last 7 days %lu, 30 days %lu, 90 days %lu, this week %lu vs %lu last week\n",
+                  (unsigned long)lastDays(7, today).contributions,
+                  (unsigned long)lastDays(30, today).contributions,
+                  (unsigned long)lastDays(90, today).contributions,
+                  (unsigned long)week(today, 0).contributions,
+                  (unsigned long)week(today, 1).contributions);
+}
+
+RangeStatistics RollingStatistics::make(const uint32_t contributions, const uint16_t activeDays, const uint16_t days)
+{
+    return {contributions, activeDays, days, days > 0 ? (float)contributions / days : 0.0f};
+}
+
+/**
+ * Limit a range to the known days
+ * @return false if no day of the range is known
+ */
+bool RollingStatistics::clamp(int32_t &from, int32_t &to) const
+{
+    if (_days == 0)
+        return false;
+
+    const int32_t lastKnown = _firstDay + (int32_t)_days - 1;
+    if (from < _firstDay)
+        from = _firstDay;
+    if (to > lastKnown)
+        to = lastKnown;
+
+    return from <= to;
+}
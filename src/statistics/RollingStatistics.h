@@ -0,0 +1,55 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Prefix sums over the contribution calendar that answer the
+ *              sum, average and active days of any range, month or weekday
+ *              in constant time.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "memory/Arena.h"
+#include "models/GitHubStats.h"
+#include "time/timeUtils.h"
+
+struct RangeStatistics
+{
+    uint32_t contributions;
+    uint16_t activeDays;
+    uint16_t days;
+    float average;
+};
+
+class RollingStatistics
+{
+public:
+    bool build(const int32_t firstDay, const uint16_t *counts, const size_t days);
+    bool build(const GitHubStats &stats, const int32_t today);
+
+    RangeStatistics range(int32_t from, int32_t to) const;
+    RangeStatistics lastDays(const uint16_t days, const int32_t today) const;
+    RangeStatistics month(const int year, const int month) const;
+    RangeStatistics weekday(const uint8_t weekday, int32_t from, int32_t to) const;
+    RangeStatistics week(const int32_t today, const int weeksAgo) const;
+
+    void print(const int32_t today) const;
+
+    static uint8_t weekdayOf(const int32_t day) { return TimeUtils::weekdayFromDays(day); }
+
+private:
+    static RangeStatistics make(const uint32_t contributions, const uint16_t activeDays, const uint16_t days);
+    bool clamp(int32_t &from, int32_t &to) const;
+
+    int32_t _firstDay = 0;
+    size_t _days = 0;
+
+    // _sums[i] and _active[i] add up the days before index i. The weekday
+    // arrays are shifted by a week and only add up every seventh day.
+    uint32_t *_sums = nullptr;
+    uint16_t *_active = nullptr;
+    uint32_t *_weekdaySums = nullptr;
+    uint16_t *_weekdayActive = nullptr;
+};
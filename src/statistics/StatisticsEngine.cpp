@@ -0,0 +1,288 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Maintains streaks, the busiest day and the average of the
+ *              contribution calendar incrementally across wakes instead of
+ *              recomputing them from all days on every fetch.
+ */
+
+#include "StatisticsEngine.h"
+
+/**
+ * Bring the statistics up to date with a fetched calendar
+ * Days finished since the last update are appended and days that left the
+ * window are dropped, both in amortized constant time per day. Only when a
+ * finished day changed afterwards, or the state is missing, all days of
+ * the window are replayed.
+ * @param previous Calendar of the last update, used to detect corrections
+ * @param fetched Calendar just fetched
+ * @param today Current day since 1970-01-01
+ */
+void StatisticsEngine::update(const GitHubStats &previous, const GitHubStats &fetched, const int32_t today)
+{
+    // Days between the last update and the fetched window are unknown
+    const bool gap = state.lastDay + 1 < fetched.startDay;
+
+    if (!state.valid || gap || today < state.today || corrected(previous, fetched))
+    {
+        rebuild(fetched, today);
+        return;
+    }
+
+    evictBefore(fetched.startDay);
+    while (state.lastDay < today - 1)
+        append(countOf(fetched, state.lastDay + 1));
+
+    state.today = today;
+    state.todayCount = countOf(fetched, today);
+}
+
+/**
+ * Write the statistics into a calendar, as shown on the display
+ * @param stats Calendar to complete
+ * @param weekday Current day of the week, 0 is Sunday
+ */
+void StatisticsEngine::fill(GitHubStats &stats, const uint8_t weekday)
+{
+    stats.longestStreak = longestStreak();
+    stats.currentStreak = currentStreak();
+    stats.maxContributions = maxContributions();
+
+    // Average contributions per day, rounded to 2 decimal places
+    stats.averageContributions = (float)stats.contributions / (365 + weekday);
+    stats.averageContributions = roundf(stats.averageContributions * 100) / 100;
+}
+
+/**
+ * Compute the statistics of a calendar from all of its days, for calendars
+ * without incremental state such as the other members of a team
+ * Streaks only cover the days of the calendar.
+ * @param stats Calendar to complete
+ * @param today Current day since 1970-01-01
+ * @param weekday Current day of the week, 0 is Sunday
+ */
+void StatisticsEngine::evaluate(GitHubStats &stats, const int32_t today, const uint8_t weekday)
+{
+    const int32_t days = today - stats.startDay + 1;
+    uint32_t streak = 0;
+    uint32_t longest = 0;
+    uint16_t max = 0;
+
+    for (int32_t i = 0; i < days && i < Window; i++)
+    {
+        const uint16_t count = stats.commits[i];
+        streak = count > 0 ? streak + 1 : 0;
+        if (streak > longest)
+            longest = streak;
+        if (count > max)
+            max = count;
+    }
+
+    stats.longestStreak = longest;
+    stats.currentStreak = days > 0 && days <= Window ? streak : 0;
+    stats.maxContributions = max;
+
+    stats.averageContributions = (float)stats.contributions / (365 + weekday);
+    stats.averageContributions = roundf(stats.averageContributions * 100) / 100;
+}
+
+/**
+ * Days with contributions in a row up to today, 0 if today has none yet
+ */
+uint32_t StatisticsEngine::currentStreak()
+{
+    return state.todayCount > 0 ? state.streak + 1 : 0;
+}
+
+/**
+ * Longest run of days with contributions in the window, or the current
+ * streak if that started before the window
+ */
+uint32_t StatisticsEngine::longestStreak()
+{
+    uint32_t longest = state.runSize > 0 ? length(runAt(0)) : 0;
+
+    if (state.todayCount > 0)
+    {
+        uint32_t untilToday = 1;
+        if (state.runSize > 0 && runAt(state.runSize - 1).last == state.lastDay - state.baseDay)
+            untilToday += length(runAt(state.runSize - 1));
+
+        if (untilToday > longest)
+            longest = untilToday;
+    }
+
+    return currentStreak() > longest ? currentStreak() : longest;
+}
+
+uint16_t StatisticsEngine::maxContributions()
+{
+    const uint16_t finished = state.maxSize > 0 ? maxAt(0).count : 0;
+    return state.todayCount > finished ? state.todayCount : finished;
+}
+
+bool StatisticsEngine::isValid()
+{
+    return state.valid;
+}
+
+void StatisticsEngine::reset()
+{
+    state = {};
+}
+
+/**
+ * Replay all finished days of the window
+ * The streak of the days that already left the window is kept, so a
+ * streak can reach back further than the window.
+ */
+void StatisticsEngine::rebuild(const GitHubStats &fetched, const int32_t today)
+{
+    uint32_t beforeStart = 0;
+    if (state.valid && state.lastDay + 1 >= fetched.startDay && fetched.startDay >= state.windowStart)
+    {
+        evictBefore(fetched.startDay);
+        beforeStart = state.beforeStart;
+    }
+
+    state = {};
+    state.valid = true;
+    state.baseDay = fetched.startDay;
+    state.windowStart = fetched.startDay;
+    state.lastDay = fetched.startDay - 1;
+    state.beforeStart = beforeStart;
+    state.streak = beforeStart;
+
+    while (state.lastDay < today - 1)
+        append(countOf(fetched, state.lastDay + 1));
+
+    state.today = today;
+    state.todayCount = countOf(fetched, today);
+}
+
+/**
+ * Append the day after lastDay
+ * @param count Contributions of that day
+ */
+void StatisticsEngine::append(const uint16_t count)
+{
+    state.lastDay++;
+    const uint16_t day = state.lastDay - state.baseDay;
+
+    const uint16_t bit = state.lastDay % ActiveBits;
+    if (count > 0)
+        state.active[bit / 8] |= 1 << (bit % 8);
+    else
+        state.active[bit / 8] &= ~(1 << (bit % 8));
+
+    // A later day with at least as many contributions outlives earlier ones
+    while (state.maxSize > 0 && maxAt(state.maxSize - 1).count <= count)
+        state.maxSize--;
+    maxAt(state.maxSize++) = {day, count};
+
+    if (count == 0)
+    {
+        state.streak = 0;
+        return;
+    }
+
+    state.streak++;
+
+    Run run = {day, day};
+    if (state.runSize > 0 && runAt(state.runSize - 1).last + 1 == day)
+        run = {runAt(--state.runSize).first, day};
+
+    // Same for runs, a later one at least as long outlives earlier ones
+    while (state.runSize > 0 && length(runAt(state.runSize - 1)) <= length(run))
+        state.runSize--;
+    runAt(state.runSize++) = run;
+}
+
+/**
+ * Drop the days before the start of the window
+ * @param day First day of the window
+ */
+void StatisticsEngine::evictBefore(const int32_t day)
+{
+    if (day <= state.windowStart)
+        return;
+
+    // Remember how the days leaving the window continue a streak
+    for (int32_t leaving = state.windowStart; leaving < day; leaving++)
+    {
+        if (leaving <= state.lastDay && isActive(leaving))
+            state.beforeStart++;
+        else
+            state.beforeStart = 0;
+    }
+
+    state.windowStart = day;
+    const int32_t first = day - state.baseDay;
+
+    while (state.maxSize > 0 && maxAt(0).day < first)
+    {
+        state.maxHead = (state.maxHead + 1) % Window;
+        state.maxSize--;
+    }
+
+    while (state.runSize > 0 && runAt(0).last < first)
+    {
+        state.runHead = (state.runHead + 1) % MaxRuns;
+        state.runSize--;
+    }
+
+    // The oldest run got shorter, drop it once a later run is at least as long
+    while (state.runSize > 1 && length(runAt(0)) <= length(runAt(1)))
+    {
+        state.runHead = (state.runHead + 1) % MaxRuns;
+        state.runSize--;
+    }
+}
+
+/**
+ * Check whether a finished day changed since the last update
+ */
+bool StatisticsEngine::corrected(const GitHubStats &previous, const GitHubStats &fetched)
+{
+    const int32_t from = state.windowStart > fetched.startDay ? state.windowStart : fetched.startDay;
+
+    if (previous.startDay == fetched.startDay && from <= state.lastDay)
+    {
+        const size_t offset = from - fetched.startDay;
+        const size_t days = state.lastDay - from + 1;
+        return memcmp(previous.commits + offset, fetched.commits + offset, days * sizeof(uint16_t)) != 0;
+    }
+
+    for (int32_t day = from; day <= state.lastDay; day++)
+    {
+        if (countOf(previous, day) != countOf(fetched, day))
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * Contributions of a day of a calendar, 0 outside of it
+ */
+uint16_t StatisticsEngine::countOf(const GitHubStats &stats, const int32_t day)
+{
+    const int32_t index = day - stats.startDay;
+    return index >= 0 && index < Window ? stats.commits[index] : 0;
+}
+
+/**
+ * Length of a run, only counting the days inside the window
+ */
+uint16_t StatisticsEngine::length(const Run &run)
+{
+    const int32_t first = state.windowStart - state.baseDay;
+    return run.last - (run.first > first ? run.first : first) + 1;
+}
+
+bool StatisticsEngine::isActive(const int32_t day)
+{
+    const uint16_t bit = day % ActiveBits;
+    return state.active[bit / 8] & (1 << (bit % 8));
+}
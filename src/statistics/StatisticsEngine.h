@@ -0,0 +1,85 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Maintains streaks, the busiest day and the average of the
+ *              contribution calendar incrementally across wakes instead of
+ *              recomputing them from all days on every fetch.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <math.h>
+#include <type_traits>
+
+#include "models/GitHubStats.h"
+
+class StatisticsEngine
+{
+public:
+    static void update(const GitHubStats &previous, const GitHubStats &fetched, const int32_t today);
+    static void fill(GitHubStats &stats, const uint8_t weekday);
+    static void evaluate(GitHubStats &stats, const int32_t today, const uint8_t weekday);
+
+    static uint32_t currentStreak();
+    static uint32_t longestStreak();
+    static uint16_t maxContributions();
+    static bool isValid();
+    static void reset();
+
+private:
+    static constexpr uint16_t Window = sizeof(GitHubStats::commits) / sizeof(GitHubStats::commits[0]);
+    static constexpr uint16_t MaxRuns = Window / 2 + 1;
+    // Ring of one bit per day, larger than the window
+    static constexpr uint16_t ActiveBits = 512;
+
+    // Candidate for the busiest day, counts decrease from front to back
+    struct MaxEntry
+    {
+        uint16_t day;
+        uint16_t count;
+    };
+
+    // Days with contributions in a row, lengths decrease from front to back
+    struct Run
+    {
+        uint16_t first;
+        uint16_t last;
+    };
+
+    // Days are stored relative to baseDay. Finished days end at lastDay,
+    // the count of today is kept apart as it changes until midnight.
+    struct State
+    {
+        bool valid;
+        int32_t baseDay;
+        int32_t windowStart;
+        int32_t lastDay;
+        int32_t today;
+        uint16_t todayCount;
+        uint32_t streak;      // Ends at lastDay and may reach back before the window
+        uint32_t beforeStart; // Days with contributions in a row up to windowStart - 1
+        uint16_t maxHead, maxSize;
+        uint16_t runHead, runSize;
+        MaxEntry maxima[Window];
+        Run runs[MaxRuns];
+        uint8_t active[ActiveBits / 8]; // Whether a day of the window had contributions
+    };
+
+    static_assert(std::is_trivially_default_constructible<State>::value,
+                  "State lives in RTC memory and must not have a constructor");
+
+    static void rebuild(const GitHubStats &fetched, const int32_t today);
+    static void append(const uint16_t count);
+    static void evictBefore(const int32_t day);
+    static bool corrected(const GitHubStats &previous, const GitHubStats &fetched);
+    static uint16_t countOf(const GitHubStats &stats, const int32_t day);
+    static uint16_t length(const Run &run);
+    static bool isActive(const int32_t day);
+
+    static MaxEntry &maxAt(const uint16_t index) { return state.maxima[(state.maxHead + index) % Window]; }
+    static Run &runAt(const uint16_t index) { return state.runs[(state.runHead + index) % MaxRuns]; }
+
+    inline static RTC_DATA_ATTR State state = {};
+};
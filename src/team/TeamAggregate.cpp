@@ -0,0 +1,235 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Merges the calendars of a team into one calendar with the sum
+ *              of every day, the top contributor per day and team streaks.
+ *              Members are added one at a time, so memory does not grow with
+ *              the size of the team.
+ */
+
+#include "TeamAggregate.h"
+
+// Days are added in words of the native register width, 2 days per word on
+// the ESP32 and 4 on 64 bit hosts
+using Word = uintptr_t;
+static constexpr size_t Lanes = sizeof(Word) / sizeof(uint16_t);
+static constexpr Word High = (Word)0x8000800080008000ULL; // Top bit of every day
+static constexpr Word Low = ~High;
+
+/**
+ * Sum the stored calendars of the whole team, one member at a time
+ * @param today Current day since 1970-01-01
+ * @param weekday Current day of the week, 0 is Sunday
+ * @return false if the arena is exhausted or no member is stored
+ */
+bool TeamAggregate::build(const int32_t today, const uint8_t weekday)
+{
+    TeamMember *member = Arena::wake().create<TeamMember>();
+    if (member == nullptr)
+        return false;
+
+    // The members are stored from one response and share the window of the
+    // fetched calendar, the first one found sets it
+    bool started = false;
+    for (uint8_t i = 0; i < TeamConfig::UserCount; i++)
+    {
+        if (!TeamStore::load(i, *member))
+            continue;
+
+        if (!started)
+        {
+            begin(member->stats.startDay);
+            started = true;
+        }
+        add(*member, i);
+    }
+
+    if (!started)
+        begin(TimeUtils::calendarStart(today, TimeConfig::CalendarWeeks));
+
+    finish(today, weekday);
+    return _members > 0;
+}
+
+/**
+ * Start an empty calendar
+ * @param startDay First day since 1970-01-01, a Sunday
+ */
+void TeamAggregate::begin(const int32_t startDay)
+{
+    _stats = {};
+    _stats.startDay = startDay;
+    _profile = {};
+    _members = 0;
+    _everyoneStreak = 0;
+    _everyoneLongest = 0;
+
+    memset(_active, 0, sizeof(_active));
+    memset(_topCount, 0, sizeof(_topCount));
+    for (uint16_t i = 0; i < Days; i++)
+        _top[i] = NoContributor;
+}
+
+/**
+ * Add the calendar of one member, calendars starting on another day are
+ * shifted onto the days of the team calendar
+ * @param member Member to add, ignored if not valid
+ * @param index Reported as top contributor of the days the member led
+ */
+void TeamAggregate::add(const TeamMember &member, const uint16_t index)
+{
+    const int32_t shift = member.stats.startDay - _stats.startDay;
+    if (!member.valid || shift <= -Days || shift >= Days)
+        return;
+
+    const size_t first = shift > 0 ? shift : 0;
+    const uint16_t *counts = member.stats.commits + (shift < 0 ? -shift : 0);
+    const size_t days = Days - (shift < 0 ? -shift : shift);
+
+    saturatingAdd(_stats.commits + first, counts, days);
+
+    const int32_t firstDay = member.stats.firstDay > _stats.startDay ? member.stats.firstDay : _stats.startDay;
+    if (_stats.firstDay == 0 || firstDay < _stats.firstDay)
+        _stats.firstDay = firstDay;
+    countActive(_active + first, counts, days);
+
+    for (size_t i = 0; i < days; i++)
+    {
+        if (counts[i] > _topCount[first + i])
+        {
+            _topCount[first + i] = counts[i];
+            _top[first + i] = index;
+        }
+    }
+
+    _stats.contributions += member.stats.contributions;
+    _profile.followers += member.profile.followers;
+    _profile.following += member.profile.following;
+    _profile.publicRepos += member.profile.publicRepos;
+    _profile.publicGists += member.profile.publicGists;
+    _members++;
+}
+
+/**
+ * Compute streaks, maximum and average of the team calendar
+ * A day counts for the team streak if anyone contributed, the everyone
+ * streak needs contributions of all members.
+ */
+void TeamAggregate::finish(const int32_t today, const uint8_t weekday)
+{
+    StatisticsEngine::evaluate(_stats, today, weekday);
+
+    const int last = index(today);
+    uint32_t streak = 0;
+    for (int i = 0; i <= last; i++)
+    {
+        streak = _members > 0 && _active[i] == _members ? streak + 1 : 0;
+        if (streak > _everyoneLongest)
+            _everyoneLongest = streak;
+    }
+    _everyoneStreak = streak;
+
+    _profile.username = TeamConfig::AggregateName;
+    char name[sizeof(_profile.name)];
+    snprintf(name, sizeof(name), getStrings().teamMembers, (unsigned)_members);
+    _profile.name = name;
+}
+
+/**
+ * Members that contributed on a day
+ */
+uint16_t TeamAggregate::activeMembers(const int32_t day) const
+{
+    const int i = index(day);
+    return i >= 0 ? _active[i] : 0;
+}
+
+/**
+ * Index of the member with the most contributions on a day, the first one
+ * wins a tie
+ * @return NoContributor if nobody contributed
+ */
+uint16_t TeamAggregate::topContributor(const int32_t day) const
+{
+    const int i = index(day);
+    return i >= 0 ? _top[i] : NoContributor;
+}
+
+void TeamAggregate::print(const int32_t today) const
+{
+    const uint16_t top = topContributor(today);
+    const int i = index(today);
+
+    Serial.printf("[Team] %u members, today %u contributions by %u, top %s, streak %d (everyone %lu, longest %lu)\n",
+                  _members, i >= 0 ? _stats.commits[i] : 0, activeMembers(today),
+                  top < TeamConfig::UserCount ? TeamConfig::Users[top] : "-",
+                  _stats.currentStreak, (unsigned long)_everyoneStreak, (unsigned long)_everyoneLongest);
+}
+
+/**
+ * Add days lane by lane, sums stick at UINT16_MAX instead of wrapping
+ * @param sums Sums per day, updated in place
+ * @param counts Days to add
+ * @param days Number of days
+ */
+void TeamAggregate::saturatingAdd(uint16_t *sums, const uint16_t *counts, const size_t days)
+{
+    size_t i = 0;
+
+    for (; i + Lanes <= days; i += Lanes)
+    {
+        Word a, b;
+        memcpy(&a, sums + i, sizeof(Word));
+        memcpy(&b, counts + i, sizeof(Word));
+
+        // Add the low 15 bits without carries between lanes, then the top bits
+        const Word low = (a & Low) + (b & Low);
+        Word sum = low ^ ((a ^ b) & High);
+
+        // Lanes that carried out of their top bit are set to all ones
+        const Word overflow = ((a & b) | ((a ^ b) & low)) & High;
+        sum |= (overflow >> 15) * 0xFFFF;
+
+        memcpy(sums + i, &sum, sizeof(Word));
+    }
+
+    for (; i < days; i++)
+    {
+        const uint32_t sum = (uint32_t)sums[i] + counts[i];
+        sums[i] = sum > UINT16_MAX ? UINT16_MAX : sum;
+    }
+}
+
+/**
+ * Count the days with contributions lane by lane
+ * @param active Members with contributions per day, updated in place
+ * @param counts Contributions of one member
+ * @param days Number of days
+ */
+void TeamAggregate::countActive(uint16_t *active, const uint16_t *counts, const size_t days)
+{
+    size_t i = 0;
+
+    for (; i + Lanes <= days; i += Lanes)
+    {
+        Word a, c;
+        memcpy(&a, active + i, sizeof(Word));
+        memcpy(&c, counts + i, sizeof(Word));
+
+        // The top bit of a lane is set if any bit of the lane is
+        const Word nonZero = (((c & Low) + Low) | c) & High;
+        a += nonZero >> 15;
+
+        memcpy(active + i, &a, sizeof(Word));
+    }
+
+    for (; i < days; i++)
+        active[i] += counts[i] > 0;
+}
+
+int TeamAggregate::index(const int32_t day) const
+{
+    const int32_t i = day - _stats.startDay;
+    return i >= 0 && i < Days ? i : -1;
+}
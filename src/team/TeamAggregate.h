@@ -0,0 +1,62 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Merges the calendars of a team into one calendar with the sum
+ *              of every day, the top contributor per day and team streaks.
+ *              Members are added one at a time, so memory does not grow with
+ *              the size of the team.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "config/teamConfig.h"
+#include "config/timeConfig.h"
+#include "i18n/i18n.h"
+#include "memory/Arena.h"
+#include "models/TeamMember.h"
+#include "statistics/StatisticsEngine.h"
+#include "time/timeUtils.h"
+#include "TeamStore.h"
+
+class TeamAggregate
+{
+public:
+    static constexpr uint16_t Days = sizeof(GitHubStats::commits) / sizeof(GitHubStats::commits[0]);
+    static constexpr uint16_t NoContributor = UINT16_MAX;
+
+    bool build(const int32_t today, const uint8_t weekday);
+
+    void begin(const int32_t startDay);
+    void add(const TeamMember &member, const uint16_t index);
+    void finish(const int32_t today, const uint8_t weekday);
+
+    const GitHubStats &stats() const { return _stats; }
+    const GitHubProfile &profile() const { return _profile; }
+    uint16_t members() const { return _members; }
+    uint16_t activeMembers(const int32_t day) const;
+    uint16_t topContributor(const int32_t day) const;
+    uint32_t everyoneStreak() const { return _everyoneStreak; }
+    uint32_t everyoneLongest() const { return _everyoneLongest; }
+
+    void print(const int32_t today) const;
+
+    static void saturatingAdd(uint16_t *sums, const uint16_t *counts, const size_t days);
+    static void countActive(uint16_t *active, const uint16_t *counts, const size_t days);
+
+private:
+    int index(const int32_t day) const;
+
+    GitHubStats _stats = {};
+    GitHubProfile _profile = {};
+    uint16_t _members = 0;
+    uint32_t _everyoneStreak = 0;  // Days in a row up to today on which every member contributed
+    uint32_t _everyoneLongest = 0;
+
+    // Per day of the calendar
+    uint16_t _active[Days] = {};
+    uint16_t _top[Days] = {};
+    uint16_t _topCount[Days] = {};
+};
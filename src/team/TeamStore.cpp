@@ -0,0 +1,114 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Profiles and calendars of the team in a LittleFS file, one
+ *              fixed size record per user, so the display can rotate through
+ *              the team on every wake without fetching again.
+ */
+
+#include "TeamStore.h"
+
+/**
+ * Mount LittleFS and create the team file with empty records if needed
+ * @return false if the file system is not available
+ */
+bool TeamStore::begin()
+{
+    if (mounted)
+        return true;
+
+    if (!LittleFS.begin(true))
+    {
+        Serial.println("[Team] Unable to mount LittleFS");
+        return false;
+    }
+
+    const size_t size = sizeof(TeamMember) * TeamConfig::UserCount;
+    if (!LittleFS.exists(TeamConfig::Path) || LittleFS.open(TeamConfig::Path, "r").size() != size)
+    {
+        File file = LittleFS.open(TeamConfig::Path, "w");
+        const TeamMember empty = {};
+        for (uint8_t i = 0; i < TeamConfig::UserCount; i++)
+            file.write(reinterpret_cast<const uint8_t *>(&empty), sizeof(empty));
+        file.close();
+    }
+
+    mounted = true;
+    return true;
+}
+
+/**
+ * Store the received members, members missing from a response keep their
+ * previous record
+ * @param members Members in the order of TeamConfig::Users
+ * @param count Number of members
+ * @return false if the file could not be written
+ */
+bool TeamStore::store(const TeamMember *members, const uint8_t count)
+{
+    if (!begin())
+        return false;
+
+    File file = LittleFS.open(TeamConfig::Path, "r+");
+    if (!file)
+        return false;
+
+    for (uint8_t i = 0; i < count && i < TeamConfig::UserCount; i++)
+    {
+        if (!members[i].valid)
+            continue;
+
+        if (!file.seek(i * sizeof(TeamMember)) ||
+            file.write(reinterpret_cast<const uint8_t *>(&members[i]), sizeof(TeamMember)) != sizeof(TeamMember))
+        {
+            Serial.printf("[Team] Unable to write %s\n", TeamConfig::Users[i]);
+            return false;
+        }
+
+        stored++;
+    }
+
+    return true;
+}
+
+/**
+ * Read the stored record of a member
+ * @param index Position in TeamConfig::Users
+ * @return false if the member was never received
+ */
+bool TeamStore::load(const uint8_t index, TeamMember &member)
+{
+    if (index >= TeamConfig::UserCount || !begin())
+        return false;
+
+    File file = LittleFS.open(TeamConfig::Path, "r");
+    const bool ok = file && file.seek(index * sizeof(TeamMember)) &&
+                    file.read(reinterpret_cast<uint8_t *>(&member), sizeof(TeamMember)) == sizeof(TeamMember);
+
+    return ok && member.valid;
+}
+
+/**
+ * Advance the rotation through the team
+ * @return Index of the member to show on this wake, UserCount for the whole
+ *         team, always 0 without rotation
+ */
+uint8_t TeamStore::next()
+{
+    if (!TeamConfig::Rotate || TeamConfig::UserCount < 2)
+        return 0;
+
+    shown = (shown + 1) % (TeamConfig::UserCount + (TeamConfig::ShowAggregate ? 1 : 0));
+    return shown;
+}
+
+void TeamStore::print()
+{
+    if (TeamConfig::UserCount < 2)
+        return;
+
+    Serial.printf("[Profiler] team: showing %s (%u of %u), %u records written\n",
+                  isAggregate(shown) ? TeamConfig::AggregateName : TeamConfig::Users[shown],
+                  shown + 1, TeamConfig::UserCount + (TeamConfig::ShowAggregate ? 1 : 0), stored);
+}
@@ -0,0 +1,35 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Profiles and calendars of the team in a LittleFS file, one
+ *              fixed size record per user, so the display can rotate through
+ *              the team on every wake without fetching again.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <LittleFS.h>
+
+#include "config/teamConfig.h"
+#include "models/TeamMember.h"
+
+class TeamStore
+{
+public:
+    static bool begin();
+    static bool store(const TeamMember *members, const uint8_t count);
+    static bool load(const uint8_t index, TeamMember &member);
+    static uint8_t next();
+    static bool isAggregate(const uint8_t view) { return view == TeamConfig::UserCount; }
+    static void print();
+
+private:
+    inline static bool mounted = false;
+    inline static uint8_t stored = 0;
+
+    // User shown on the last wake, UserCount for the whole team
+    inline static RTC_DATA_ATTR uint8_t shown = 0;
+};
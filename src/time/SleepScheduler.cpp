@@ -0,0 +1,143 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Computes the next wake from the local clock, aligned to full
+ *              hours, just after midnight and stretched overnight or while
+ *              the contribution calendar does not change.
+ */
+
+#include "SleepScheduler.h"
+
+/**
+ * Count the fetches in a row that did not change the calendar
+ * @param changed true if the fetched calendar differs from the cached one
+ */
+void SleepScheduler::recordCalendar(const bool changed)
+{
+    if (changed)
+        unchangedWakes = 0;
+    else if (unchangedWakes < UINT8_MAX)
+        unchangedWakes++;
+}
+
+/**
+ * Next wake as epoch
+ * Full hours are counted from the local minutes and seconds, DST only moves
+ * the clock by whole hours and keeps this alignment. Midnight and the end
+ * of the night are local wall clock times resolved with mktime.
+ * @param now Current epoch
+ * @return Epoch to wake up at, 0 if the clock is not set
+ */
+time_t SleepScheduler::nextWake(const time_t now)
+{
+    _now = now;
+    _wake = 0;
+    _midnight = 0;
+
+    if (now < TimeConfig::MinValidTime)
+    {
+        _reason = "clock not set";
+        return 0;
+    }
+
+    tm local;
+    localtime_r(&now, &local);
+
+    const bool idle = unchangedWakes >= TimeConfig::IdleAfterWakes;
+    const uint32_t interval = idle ? TimeConfig::IdleWakeInterval : TimeConfig::WakeInterval;
+    const time_t hourStart = now - (local.tm_min * 60 + local.tm_sec);
+
+    time_t wake = hourStart + interval;
+    if (wake - now < (time_t)TimeConfig::MinSleep)
+        wake += 3600;
+    _reason = idle ? "calendar unchanged" : "interval";
+
+    if (local.tm_hour < TimeConfig::NightEndHour)
+    {
+        const time_t nightEnd = atLocal(local, 0, TimeConfig::NightEndHour, 0);
+        if (nightEnd - now >= (time_t)TimeConfig::MinSleep)
+        {
+            wake = nightEnd;
+            _reason = "night";
+        }
+    }
+
+    // Wakes in the last hour before midnight move to just after it
+    const time_t midnight = atLocal(local, 1, 0, TimeConfig::MidnightDelay);
+    _midnight = midnight;
+    if (wake + 3600 > midnight)
+    {
+        wake = midnight;
+        _reason = "midnight";
+    }
+
+    _wake = wake;
+    return wake;
+}
+
+/**
+ * Sleep duration until the next wake
+ * @param now Current epoch
+ * @return Duration in microseconds, TimeConfig::SleepTime if the clock is not set
+ */
+uint64_t SleepScheduler::sleepDurationUs(const time_t now)
+{
+    const time_t wake = nextWake(now);
+    if (wake == 0)
+        return TimeConfig::SleepTime;
+
+    return (uint64_t)(wake - now) * 1000000ULL;
+}
+
+/**
+ * Cap a sleep that was stretched for the battery or the rate limit at the
+ * wake after midnight, so the new day still shows up
+ * @param sleepUs Stretched sleep duration in microseconds
+ * @return Sleep duration in microseconds, unchanged if the clock is not set
+ */
+uint64_t SleepScheduler::limitToMidnight(const uint64_t sleepUs) const
+{
+    if (_midnight == 0)
+        return sleepUs;
+
+    const uint64_t untilMidnight = (uint64_t)(_midnight - _now) * 1000000ULL;
+    if (sleepUs <= untilMidnight)
+        return sleepUs;
+
+    Serial.printf("[Sleep] stretched sleep capped at midnight, %llu s instead of %llu s\n",
+                  untilMidnight / 1000000ULL, sleepUs / 1000000ULL);
+    return untilMidnight;
+}
+
+void SleepScheduler::print() const
+{
+    if (_wake == 0)
+    {
+        Serial.printf("[Sleep] %s, sleeping %llu s\n", _reason, TimeConfig::SleepTime / 1000000ULL);
+        return;
+    }
+
+    tm wake;
+    localtime_r(&_wake, &wake);
+    Serial.printf("[Sleep] next wake %02d:%02d:%02d in %ld s (%s, %u unchanged)\n",
+                  wake.tm_hour, wake.tm_min, wake.tm_sec, (long)(_wake - _now), _reason, unchangedWakes);
+}
+
+/**
+ * Epoch of a local wall clock time relative to a given day
+ * @param day Local date to start from
+ * @param dayOffset Days to add to the date
+ * @param hour Local hour
+ * @param second Seconds after the full hour
+ */
+time_t SleepScheduler::atLocal(const tm &day, const int dayOffset, const int hour, const int second)
+{
+    tm target = day;
+    target.tm_mday += dayOffset;
+    target.tm_hour = hour;
+    target.tm_min = 0;
+    target.tm_sec = second;
+    target.tm_isdst = -1; // Let mktime decide whether DST applies on that day
+    return mktime(&target);
+}
@@ -0,0 +1,36 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Computes the next wake from the local clock, aligned to full
+ *              hours, just after midnight and stretched overnight or while
+ *              the contribution calendar does not change.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "config/timeConfig.h"
+
+class SleepScheduler
+{
+public:
+    static void recordCalendar(const bool changed);
+
+    time_t nextWake(const time_t now);
+    uint64_t sleepDurationUs(const time_t now);
+    uint64_t limitToMidnight(const uint64_t sleepUs) const;
+    void print() const;
+
+private:
+    static time_t atLocal(const tm &day, const int dayOffset, const int hour, const int second);
+
+    time_t _now = 0;
+    time_t _wake = 0;
+    time_t _midnight = 0;
+    const char *_reason = "";
+
+    inline static RTC_DATA_ATTR uint8_t unchangedWakes = 0;
+};
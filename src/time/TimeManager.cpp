@@ -2,97 +2,133 @@
  * Created on: 2026-07-25
  * Author(s): Toni Fey
  * License: MIT
- * Description: Manages NTP synchronization, local time retrieval and
- *              formatted date/time strings for the ESP32 application.
+ * Description: Manages NTP synchronization and captures the local time of a
+ *              wake for the ESP32 application.
  */
 
 #include "TimeManager.h"
 
-bool TimeManager::begin()
-{
-    configTime(TimeConfig::GmtOffset, TimeConfig::DstOffset, TimeConfig::Server);
+#include "../models/GitHubStats.h"
 
-    tm time;
+static_assert((TimeConfig::CalendarWeeks + 1) * 7 <= sizeof(GitHubStats::commits) / sizeof(GitHubStats::commits[0]),
+              "The calendar range does not fit GitHubStats::commits");
 
-    _synchronized = ::getLocalTime(&time);
+/**
+ * Establish the local time using the cheapest valid source
+ * The RTC keeps counting through deep sleep, so after the first NTP sync the
+ * clock is only re-synchronized every SyncEveryWakes wakes or when a Date
+ * header showed too much drift. Between syncs correct() trims the clock.
+ * @return true if the clock holds a valid time
+ */
+bool TimeManager::begin()
+{
+    setenv("TZ", TimeConfig::Timezone, 1);
+    tzset();
 
-    return _synchronized;
-}
+    const bool rtcValid = time(nullptr) >= TimeConfig::MinValidTime;
 
-tm TimeManager::getLocalTime() const
-{
-    tm time;
+    if (rtcValid && wakesSinceSync < TimeConfig::SyncEveryWakes)
+    {
+        wakesSinceSync++;
+        _synchronized = true;
+        Serial.printf("[Time] Using RTC, %u wakes since NTP sync\n", wakesSinceSync);
+        return _synchronized;
+    }
 
-    ::getLocalTime(&time);
+    // SNTP keeps the pointer to the server name, so the address needs static storage
+    static char server[16];
+    const char *ntpServer = TimeConfig::Server;
 
-    return time;
-}
+    IPAddress ip;
+    if (DNSCache::resolve(TimeConfig::Server, ip))
+    {
+        strlcpy(server, ip.toString().c_str(), sizeof(server));
+        ntpServer = server;
+    }
 
-String TimeManager::getFormattedDate() const
-{
-    char timeStr[64];
+    configTzTime(TimeConfig::Timezone, ntpServer);
 
     tm time;
 
-    ::getLocalTime(&time);
+    _synchronized = ::getLocalTime(&time);
 
-    sprintf(timeStr, "%02d/%02d/%04d",
-            time.tm_mday,
-            time.tm_mon + 1,
-            time.tm_year + 1900);
+    if (_synchronized)
+    {
+        wakesSinceSync = 0;
+        Serial.println("[Time] Synchronized with NTP");
+    }
+    else
+    {
+        // Fall back to the RTC and try NTP again on the next wake
+        _synchronized = rtcValid;
+    }
 
-    return String(timeStr);
+    return _synchronized;
 }
 
-String TimeManager::getFormattedTime() const
+bool TimeManager::isSynchronized() const
 {
-    char timeStr[64];
-
-    tm time;
-
-    ::getLocalTime(&time);
-
-    sprintf(timeStr, "%02d:%02d:%02d",
-            time.tm_hour,
-            time.tm_min,
-            time.tm_sec);
-
-    return String(timeStr);
+    return _synchronized;
 }
 
-String TimeManager::getFormattedDateTime() const
+/**
+ * Correct the clock from the Date header of an HTTPS response
+ * Only the first response of a wake is used. Small offsets are corrected
+ * directly, a large one forces a full NTP sync on the next wake.
+ * @param httpDate Value of the Date header
+ */
+void TimeManager::correct(const char *httpDate)
 {
-    char timeStr[64];
+    const time_t server = TimeUtils::parseHTTPDate(httpDate);
+    if (server == 0)
+        return;
 
-    tm time;
+    // Responses arrive on concurrent executor tasks, only the first one sets the clock
+    portENTER_CRITICAL(&lock);
+    const bool first = !corrected;
+    corrected = true;
+    portEXIT_CRITICAL(&lock);
+
+    if (!first)
+        return;
 
-    ::getLocalTime(&time);
+    const long drift = (long)(server - time(nullptr));
+    if (labs(drift) < (long)TimeConfig::MaxDrift)
+        return;
 
-    sprintf(timeStr, "%02d/%02d/%04d %02d:%02d:%02d",
-            time.tm_mday,
-            time.tm_mon + 1,
-            time.tm_year + 1900,
-            time.tm_hour,
-            time.tm_min,
-            time.tm_sec);
+    const timeval now = {server, 0};
+    settimeofday(&now, nullptr);
+    Serial.printf("[Time] Corrected clock by %ld s from Date header\n", drift);
 
-    return String(timeStr);
+    if (labs(drift) >= (long)TimeConfig::ResyncDrift)
+        wakesSinceSync = TimeConfig::SyncEveryWakes;
 }
 
-uint64_t TimeManager::getSleepDurationUs() const
+/**
+ * Capture the time part of the wake context from a single clock reading
+ * @param context Context to fill
+ */
+void TimeManager::capture(WakeContext &context) const
 {
-    tm time;
-    float timeTillWakeUp;
-
-    ::getLocalTime(&time);
-
-    timeTillWakeUp -= (time.tm_min * 60 + time.tm_sec) * 1e6;
-
-    return timeTillWakeUp;
+    context.now = time(nullptr);
+    localtime_r(&context.now, &context.local);
+    context.weekday = context.local.tm_wday;
+    context.today = TimeUtils::daysFromCivil(context.local.tm_year + 1900, context.local.tm_mon + 1, context.local.tm_mday);
+
+    snprintf(context.timeString, sizeof(context.timeString), "%02d/%02d/%04d %02d:%02d:%02d",
+             context.local.tm_mday,
+             context.local.tm_mon + 1,
+             context.local.tm_year + 1900,
+             context.local.tm_hour,
+             context.local.tm_min,
+             context.local.tm_sec);
+
+    context.rangeTo = context.local;
+
+    // Whole weeks only, so the range fits GitHubStats::commits on any weekday
+    const int32_t start = TimeUtils::calendarStart(context.today, TimeConfig::CalendarWeeks);
+    context.rangeFrom = context.local;
+    context.rangeFrom.tm_mday -= context.today - start;
+    context.rangeFrom.tm_isdst = -1;
+    mktime(&context.rangeFrom);
 }
-
-uint8_t TimeManager::getWeekday() const {
-    tm time;
-    ::getLocalTime(&time);
-    return time.tm_wday;
-}
\ No newline at end of file
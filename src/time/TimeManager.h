@@ -2,28 +2,32 @@
  * Created on: 2026-07-25
  * Author(s): Toni Fey
  * License: MIT
- * Description: Manages NTP synchronization, local time retrieval and
- *              formatted date/time strings for the ESP32 application.
+ * Description: Manages NTP synchronization and captures the local time of a
+ *              wake for the ESP32 application.
  */
 
 #pragma once
 
 #include <Arduino.h>
+#include <sys/time.h>
 
 #include "../config/timeConfig.h"
+#include "../models/wakeContext.h"
+#include "../WiFiManager/DNSCache.h"
+#include "timeUtils.h"
 
 class TimeManager
 {
 public:
     bool begin();
     bool isSynchronized() const;
-    tm getLocalTime() const;
-    String getFormattedDate() const;
-    String getFormattedTime() const;
-    String getFormattedDateTime() const;
-    uint64_t getSleepDurationUs() const;
-    uint8_t getWeekday() const;
+    static void correct(const char *httpDate);
+    void capture(WakeContext &context) const;
 
 private:
     bool _synchronized = false;
+
+    inline static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    inline static bool corrected = false;
+    inline static RTC_DATA_ATTR uint16_t wakesSinceSync = TimeConfig::SyncEveryWakes;
 };
\ No newline at end of file
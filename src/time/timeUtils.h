@@ -0,0 +1,120 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Calendar helpers for converting UTC dates and timestamps
+ *              without depending on the timezone of the C library.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+namespace TimeUtils
+{
+    /**
+     * Days since 1970-01-01 of a proleptic Gregorian date
+     * @param year Full year, e.g. 2026
+     * @param month Month 1-12
+     * @param day Day of month 1-31
+     */
+    inline int32_t daysFromCivil(int32_t year, const uint32_t month, const uint32_t day)
+    {
+        year -= month <= 2;
+        const int32_t era = (year >= 0 ? year : year - 399) / 400;
+        const uint32_t yoe = (uint32_t)(year - era * 400);
+        const uint32_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + (int32_t)doe - 719468;
+    }
+
+    /**
+     * Year of a day counted since 1970-01-01, inverse of daysFromCivil
+     * @param days Days since 1970-01-01
+     */
+    inline int32_t yearFromDays(int32_t days)
+    {
+        days += 719468;
+        const int32_t era = (days >= 0 ? days : days - 146096) / 146097;
+        const uint32_t doe = (uint32_t)(days - era * 146097);
+        const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const uint32_t mp = (5 * doy + 2) / 153;
+        return (int32_t)yoe + era * 400 + (mp >= 10);
+    }
+
+    /**
+     * Day of the week of a day counted since 1970-01-01, which was a Thursday
+     * @return 0 for Sunday to 6 for Saturday
+     */
+    inline uint8_t weekdayFromDays(const int32_t days)
+    {
+        return (days % 7 + 11) % 7;
+    }
+
+    /**
+     * First day of a calendar of whole weeks that ends with the current one
+     * @param today Days since 1970-01-01
+     * @param weeks Full weeks before the current one
+     * @return The Sunday that many weeks before the current week
+     */
+    inline int32_t calendarStart(const int32_t today, const uint8_t weeks)
+    {
+        return today - weekdayFromDays(today) - 7 * (int32_t)weeks;
+    }
+
+    /**
+     * Parse a date such as "2026-10-18"
+     * @return Days since 1970-01-01, 0 if the string is malformed
+     */
+    inline int32_t parseDate(const char *text)
+    {
+        if (text == nullptr || strlen(text) < 10 || text[4] != '-' || text[7] != '-')
+            return 0;
+
+        return daysFromCivil(atoi(text), atoi(text + 5), atoi(text + 8));
+    }
+
+    inline time_t fromUTC(const int year, const int month, const int day,
+                          const int hour, const int minute, const int second)
+    {
+        return (time_t)daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    }
+
+    /**
+     * Parse an ISO 8601 UTC timestamp such as "2026-10-18T09:30:00Z"
+     * @return Epoch seconds, 0 if the string is malformed
+     */
+    inline time_t parseISO8601(const char *text)
+    {
+        if (text == nullptr || strlen(text) < 19 || text[4] != '-' || text[7] != '-' || text[10] != 'T')
+            return 0;
+
+        return fromUTC(atoi(text), atoi(text + 5), atoi(text + 8),
+                       atoi(text + 11), atoi(text + 14), atoi(text + 17));
+    }
+
+    /**
+     * Parse an HTTP date (RFC 7231 IMF-fixdate) such as "Sun, 18 Oct 2026 09:30:00 GMT"
+     * @return Epoch seconds, 0 if the string is malformed
+     */
+    inline time_t parseHTTPDate(const char *text)
+    {
+        static const char Months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+        if (text == nullptr || strlen(text) < 29 || text[3] != ',')
+            return 0;
+
+        int month = 0;
+        while (month < 12 && strncmp(Months + month * 3, text + 8, 3) != 0)
+            month++;
+        if (month == 12)
+            return 0;
+
+        return fromUTC(atoi(text + 12), month + 1, atoi(text + 5),
+                       atoi(text + 17), atoi(text + 20), atoi(text + 23));
+    }
+}
@@ -18,5 +18,5 @@ public:
 
 private:
     float _startTime = -1;
-    bool _started = true;
+    bool _started = false;
 };
\ No newline at end of file
@@ -0,0 +1,144 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: HTTPS transport on top of the ESP32 HTTPClient and WiFiClientSecure
+ */
+
+#ifdef ARDUINO
+
+#include "ESP32Transport.h"
+
+int ESP32Transport::begin(const HTTPRequest &request)
+{
+    _timing = HTTPTiming();
+    _start = millis();
+    _stream = nullptr;
+
+    _client.setInsecure();
+
+    // HTTP/1.0 responses are never chunked, so the body can be streamed as is
+    _https.useHTTP10(true);
+
+    connectCached(request.url);
+
+    if (!_https.begin(_client, request.url))
+    {
+        Serial.println("[HTTPS] Unable to connect");
+        return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+
+    for (size_t i = 0; i < request.headerCount; i++)
+    {
+        _https.addHeader(request.headers[i].key, request.headers[i].value);
+    }
+
+    const char *collect[CollectedHeaderCount];
+    for (size_t i = 0; i < CollectedHeaderCount; i++)
+        collect[i] = CollectedHeaders[i];
+    _https.collectHeaders(collect, CollectedHeaderCount);
+
+    int httpCode = _https.sendRequest(request.method, (uint8_t *)request.body, request.bodyLength);
+    _timing.headersMs = millis() - _start;
+
+    if (httpCode <= 0)
+    {
+        Serial.printf("[HTTPS] %s failed, error: %s\n", request.method, _https.errorToString(httpCode).c_str());
+        return httpCode;
+    }
+
+    for (size_t i = 0; i < CollectedHeaderCount; i++)
+    {
+        strlcpy(_headerValues[i], _https.header(CollectedHeaders[i]).c_str(), HeaderValueLength);
+    }
+
+    _contentLength = _https.getSize();
+    _remaining = _contentLength;
+    _stream = _https.getStreamPtr();
+
+    return httpCode;
+}
+
+/**
+ * Open the TLS connection to the cached address of the host
+ * HTTPClient reuses an already connected client instead of resolving the
+ * host again. If this fails, HTTPClient connects on its own.
+ * @param url Request URL
+ */
+void ESP32Transport::connectCached(const char *url)
+{
+    const char *prefix = "https://";
+    if (strncmp(url, prefix, strlen(prefix)) != 0)
+        return;
+
+    const char *hostStart = url + strlen(prefix);
+    const size_t hostLength = strcspn(hostStart, ":/");
+
+    char host[sizeof(DNSEntry::host)];
+    if (hostLength >= sizeof(host))
+        return;
+    memcpy(host, hostStart, hostLength);
+    host[hostLength] = '\0';
+
+    const uint16_t port = hostStart[hostLength] == ':' ? atoi(hostStart + hostLength + 1) : 443;
+
+    IPAddress ip;
+    if (!DNSCache::resolve(host, ip))
+        return;
+
+    if (_client.connect(ip, port, host, nullptr, nullptr, nullptr))
+        return;
+
+    // The cached address may be outdated, resolve once more
+    DNSCache::invalidate(host);
+    if (DNSCache::resolve(host, ip))
+        _client.connect(ip, port, host, nullptr, nullptr, nullptr);
+}
+
+const char *ESP32Transport::header(const char *name) const
+{
+    for (size_t i = 0; i < CollectedHeaderCount; i++)
+    {
+        if (strcasecmp(name, CollectedHeaders[i]) == 0)
+            return _headerValues[i][0] != '\0' ? _headerValues[i] : nullptr;
+    }
+    return nullptr;
+}
+
+int ESP32Transport::contentLength() const
+{
+    return _contentLength;
+}
+
+int ESP32Transport::read()
+{
+    char c;
+    return readBytes(&c, 1) == 1 ? (uint8_t)c : -1;
+}
+
+size_t ESP32Transport::readBytes(char *buffer, size_t length)
+{
+    if (_stream == nullptr || _remaining == 0)
+        return 0;
+
+    if (_remaining > 0 && length > (size_t)_remaining)
+        length = _remaining;
+
+    // Stream::readBytes waits up to the stream timeout for data to arrive
+    size_t received = _stream->readBytes(buffer, length);
+
+    if (_remaining > 0)
+        _remaining -= received;
+    _timing.bytesReceived += received;
+
+    return received;
+}
+
+void ESP32Transport::end()
+{
+    _https.end();
+    _stream = nullptr;
+    _timing.totalMs = millis() - _start;
+}
+
+#endif
@@ -0,0 +1,41 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: HTTPS transport on top of the ESP32 HTTPClient and WiFiClientSecure
+ */
+
+#pragma once
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+
+#include "HTTPTransport.h"
+#include "WiFiManager/DNSCache.h"
+
+class ESP32Transport : public HTTPTransport
+{
+public:
+    int begin(const HTTPRequest &request) override;
+    const char *header(const char *name) const override;
+    int contentLength() const override;
+    int read() override;
+    size_t readBytes(char *buffer, size_t length) override;
+    void end() override;
+
+private:
+    void connectCached(const char *url);
+
+    WiFiClientSecure _client;
+    HTTPClient _https;
+    Stream *_stream = nullptr;
+    int _contentLength = -1;
+    int _remaining = -1;
+    uint32_t _start = 0;
+    char _headerValues[CollectedHeaderCount][HeaderValueLength] = {};
+};
+
+#endif
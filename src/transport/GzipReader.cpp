@@ -0,0 +1,181 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Streaming gzip decoder that sits between a transport and the
+ *              JSON parser, inflating the body incrementally with tinfl.
+ */
+
+#include "GzipReader.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// gzip header flags (RFC 1952)
+static constexpr uint8_t FlagHeaderCRC = 0x02;
+static constexpr uint8_t FlagExtra = 0x04;
+static constexpr uint8_t FlagName = 0x08;
+static constexpr uint8_t FlagComment = 0x10;
+
+GzipReader::GzipReader(HTTPTransport &source, const size_t inputSize)
+    : _source(source), _inputSize(inputSize)
+{
+}
+
+GzipReader::~GzipReader()
+{
+    free(_inflator);
+    free(_dictionary);
+    free(_input);
+}
+
+/**
+ * Allocate the inflate state and consume the gzip header
+ * The deflate window needs the full 32 KiB dictionary, only the input
+ * buffer size is configurable.
+ * @return false if memory is missing or the body is not gzip
+ */
+bool GzipReader::begin()
+{
+    _inflator = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+    _dictionary = (uint8_t *)malloc(DictionarySize);
+    _input = (uint8_t *)malloc(_inputSize);
+
+    if (_inflator == nullptr || _dictionary == nullptr || _input == nullptr)
+    {
+        printf("[gzip] Not enough memory to inflate the response\n");
+        return false;
+    }
+
+    tinfl_init(_inflator);
+
+    if (!skipHeader())
+    {
+        printf("[gzip] Invalid gzip header\n");
+        return false;
+    }
+
+    return true;
+}
+
+int GzipReader::read()
+{
+    char c;
+    return readBytes(&c, 1) == 1 ? (uint8_t)c : -1;
+}
+
+size_t GzipReader::readBytes(char *buffer, size_t length)
+{
+    size_t produced = 0;
+
+    while (produced < length)
+    {
+        if (_outputAvailable == 0 && !inflateMore())
+            break;
+
+        size_t chunk = length - produced;
+        if (chunk > _outputAvailable)
+            chunk = _outputAvailable;
+
+        memcpy(buffer + produced, _dictionary + _outputPos, chunk);
+        _outputPos += chunk;
+        _outputAvailable -= chunk;
+        produced += chunk;
+    }
+
+    return produced;
+}
+
+/**
+ * Inflate the next block into the circular dictionary
+ * @return false once the stream ended or failed
+ */
+bool GzipReader::inflateMore()
+{
+    while (!_done)
+    {
+        if (_inputPos == _inputLength && !_inputEnd)
+        {
+            _inputLength = _source.readBytes((char *)_input, _inputSize);
+            _inputPos = 0;
+            _inputEnd = _inputLength == 0;
+        }
+
+        size_t inputBytes = _inputLength - _inputPos;
+        size_t outputBytes = DictionarySize - _dictionaryPos;
+
+        const tinfl_status status = tinfl_decompress(_inflator,
+                                                     _input + _inputPos, &inputBytes,
+                                                     _dictionary, _dictionary + _dictionaryPos, &outputBytes,
+                                                     _inputEnd ? 0 : TINFL_FLAG_HAS_MORE_INPUT);
+
+        _inputPos += inputBytes;
+        _outputPos = _dictionaryPos;
+        _outputAvailable = outputBytes;
+        _dictionaryPos = (_dictionaryPos + outputBytes) & (DictionarySize - 1);
+        _inflatedBytes += outputBytes;
+
+        if (status < TINFL_STATUS_DONE)
+            printf("[gzip] Inflate failed (%d)\n", (int)status);
+
+        if (status <= TINFL_STATUS_DONE || (status == TINFL_STATUS_NEEDS_MORE_INPUT && _inputEnd))
+            _done = true;
+
+        if (outputBytes > 0)
+            return true;
+    }
+
+    return false;
+}
+
+bool GzipReader::skipHeader()
+{
+    uint8_t header[10];
+    if (_source.readBytes((char *)header, sizeof(header)) != sizeof(header))
+        return false;
+
+    // Magic bytes and deflate compression method
+    if (header[0] != 0x1f || header[1] != 0x8b || header[2] != 8)
+        return false;
+
+    const uint8_t flags = header[3];
+
+    if (flags & FlagExtra)
+    {
+        uint8_t length[2];
+        if (_source.readBytes((char *)length, 2) != 2)
+            return false;
+        for (uint16_t i = length[0] | (length[1] << 8); i > 0; i--)
+        {
+            if (_source.read() < 0)
+                return false;
+        }
+    }
+
+    if ((flags & FlagName) && !skipString())
+        return false;
+
+    if ((flags & FlagComment) && !skipString())
+        return false;
+
+    if (flags & FlagHeaderCRC)
+    {
+        char crc[2];
+        if (_source.readBytes(crc, 2) != 2)
+            return false;
+    }
+
+    return true;
+}
+
+bool GzipReader::skipString()
+{
+    int c;
+    do
+    {
+        c = _source.read();
+    } while (c > 0);
+
+    return c == 0;
+}
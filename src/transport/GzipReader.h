@@ -0,0 +1,52 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Streaming gzip decoder that sits between a transport and the
+ *              JSON parser, inflating the body incrementally with tinfl.
+ */
+
+#pragma once
+
+#ifdef ARDUINO
+#include <rom/miniz.h>
+#else
+#include <miniz.h>
+#endif
+
+#include "HTTPTransport.h"
+
+class GzipReader
+{
+public:
+    GzipReader(HTTPTransport &source, const size_t inputSize);
+    ~GzipReader();
+
+    bool begin();
+    int read();
+    size_t readBytes(char *buffer, size_t length);
+
+    uint32_t inflatedBytes() const { return _inflatedBytes; }
+
+private:
+    static constexpr size_t DictionarySize = TINFL_LZ_DICT_SIZE;
+
+    bool skipHeader();
+    bool skipString();
+    bool inflateMore();
+
+    HTTPTransport &_source;
+    tinfl_decompressor *_inflator = nullptr;
+    uint8_t *_dictionary = nullptr;
+    uint8_t *_input = nullptr;
+    size_t _inputSize;
+
+    size_t _inputPos = 0;
+    size_t _inputLength = 0;
+    bool _inputEnd = false;
+    size_t _dictionaryPos = 0;
+    size_t _outputPos = 0;
+    size_t _outputAvailable = 0;
+    bool _done = false;
+    uint32_t _inflatedBytes = 0;
+};
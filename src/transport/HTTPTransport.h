@@ -0,0 +1,75 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Platform independent HTTP transport interface. A transport sends
+ *              one request at a time and exposes the response body as a stream
+ *              that can be handed to the JSON parser directly.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "models/HTTPHeader.h"
+
+struct HTTPRequest
+{
+    const char *method;
+    const char *url;
+    const HTTPHeader *headers;
+    size_t headerCount;
+    const char *body;
+    size_t bodyLength;
+};
+
+struct HTTPTiming
+{
+    uint32_t headersMs = 0; // Until status line and headers were received
+    uint32_t totalMs = 0;   // Until the transport was ended
+    uint32_t bytesReceived = 0;
+};
+
+class HTTPTransport
+{
+public:
+    // Response headers that are kept after begin() returned
+    inline static constexpr const char *CollectedHeaders[] = {
+        "Date",
+        "Content-Encoding",
+        "X-RateLimit-Limit",
+        "X-RateLimit-Remaining",
+        "X-RateLimit-Reset",
+        "X-RateLimit-Resource"};
+    static constexpr size_t CollectedHeaderCount = sizeof(CollectedHeaders) / sizeof(CollectedHeaders[0]);
+    static constexpr size_t HeaderValueLength = 64;
+
+    virtual ~HTTPTransport() = default;
+
+    /**
+     * Send the request and receive status line and headers
+     * @return HTTP status code, or a value <= 0 on transport errors
+     */
+    virtual int begin(const HTTPRequest &request) = 0;
+
+    /**
+     * @return Value of a collected response header, or nullptr if it is not
+     *         collected or was not part of the response
+     */
+    virtual const char *header(const char *name) const = 0;
+
+    // Body length announced by the server, -1 if unknown
+    virtual int contentLength() const = 0;
+
+    // Body reader, these two methods make the transport a valid ArduinoJson reader
+    virtual int read() = 0;
+    virtual size_t readBytes(char *buffer, size_t length) = 0;
+
+    virtual void end() = 0;
+
+    const HTTPTiming &timing() const { return _timing; }
+
+protected:
+    HTTPTiming _timing;
+};
@@ -0,0 +1,271 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Plain HTTP/1.0 transport on POSIX sockets. Used to run the fetch
+ *              and parse path on a development machine against a local
+ *              stand-in for the GitHub API.
+ */
+
+#ifndef ARDUINO
+
+#include "PosixTransport.h"
+
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+PosixTransport::PosixTransport(const uint32_t timeoutMs)
+    : _timeoutMs(timeoutMs)
+{
+}
+
+PosixTransport::~PosixTransport()
+{
+    end();
+}
+
+/**
+ * Send the request to an http:// URL and read status line and headers
+ * @param request Request to send
+ * @return HTTP status code, or -1 on connection or protocol errors
+ */
+int PosixTransport::begin(const HTTPRequest &request)
+{
+    _timing = HTTPTiming();
+    _start = now();
+    _bufferPos = _bufferLength = 0;
+    _contentLength = _remaining = -1;
+    memset(_headerValues, 0, sizeof(_headerValues));
+
+    // Split http://host[:port]/path
+    const char *prefix = "http://";
+    if (strncmp(request.url, prefix, strlen(prefix)) != 0)
+    {
+        fprintf(stderr, "[HTTP] Only http:// URLs are supported: %s\n", request.url);
+        return -1;
+    }
+
+    const char *hostStart = request.url + strlen(prefix);
+    const char *slash = strchr(hostStart, '/');
+    const char *path = slash != nullptr ? slash : "/";
+    const size_t hostLength = slash != nullptr ? (size_t)(slash - hostStart) : strlen(hostStart);
+
+    char host[128];
+    char port[8] = "80";
+    snprintf(host, sizeof(host), "%.*s", (int)hostLength, hostStart);
+
+    char *colon = strchr(host, ':');
+    if (colon != nullptr)
+    {
+        snprintf(port, sizeof(port), "%s", colon + 1);
+        *colon = '\0';
+    }
+
+    if (!connectTo(host, port))
+        return -1;
+
+    char line[512];
+    int length = snprintf(line, sizeof(line), "%s %s HTTP/1.0\r\nHost: %s\r\nContent-Length: %u\r\n",
+                          request.method, path, host, (unsigned)request.bodyLength);
+    if (!sendAll(line, length))
+        return -1;
+
+    for (size_t i = 0; i < request.headerCount; i++)
+    {
+        length = snprintf(line, sizeof(line), "%s: %s\r\n", request.headers[i].key, request.headers[i].value);
+        if (!sendAll(line, length))
+            return -1;
+    }
+
+    if (!sendAll("\r\n", 2) || (request.bodyLength > 0 && !sendAll(request.body, request.bodyLength)))
+        return -1;
+
+    // Status line, e.g. "HTTP/1.1 200 OK"
+    if (!readLine(line, sizeof(line)))
+        return -1;
+
+    const char *status = strchr(line, ' ');
+    const int httpCode = status != nullptr ? atoi(status + 1) : -1;
+
+    while (readLine(line, sizeof(line)) && line[0] != '\0')
+    {
+        char *separator = strchr(line, ':');
+        if (separator == nullptr)
+            continue;
+
+        *separator = '\0';
+        const char *value = separator + 1;
+        while (*value == ' ')
+            value++;
+
+        if (strcasecmp(line, "Content-Length") == 0)
+            _contentLength = atoi(value);
+
+        for (size_t i = 0; i < CollectedHeaderCount; i++)
+        {
+            if (strcasecmp(line, CollectedHeaders[i]) == 0)
+                snprintf(_headerValues[i], HeaderValueLength, "%s", value);
+        }
+    }
+
+    _remaining = _contentLength;
+    _timing.headersMs = now() - _start;
+
+    return httpCode;
+}
+
+const char *PosixTransport::header(const char *name) const
+{
+    for (size_t i = 0; i < CollectedHeaderCount; i++)
+    {
+        if (strcasecmp(name, CollectedHeaders[i]) == 0)
+            return _headerValues[i][0] != '\0' ? _headerValues[i] : nullptr;
+    }
+    return nullptr;
+}
+
+int PosixTransport::contentLength() const
+{
+    return _contentLength;
+}
+
+int PosixTransport::read()
+{
+    char c;
+    return readBytes(&c, 1) == 1 ? (uint8_t)c : -1;
+}
+
+size_t PosixTransport::readBytes(char *buffer, size_t length)
+{
+    size_t received = 0;
+
+    while (received < length && _remaining != 0)
+    {
+        if (_bufferPos == _bufferLength && fill() <= 0)
+            break;
+
+        size_t chunk = _bufferLength - _bufferPos;
+        if (chunk > length - received)
+            chunk = length - received;
+        if (_remaining > 0 && chunk > (size_t)_remaining)
+            chunk = _remaining;
+
+        memcpy(buffer + received, _buffer + _bufferPos, chunk);
+        _bufferPos += chunk;
+        received += chunk;
+        if (_remaining > 0)
+            _remaining -= chunk;
+    }
+
+    _timing.bytesReceived += received;
+    return received;
+}
+
+void PosixTransport::end()
+{
+    if (_socket < 0)
+        return;
+
+    close(_socket);
+    _socket = -1;
+    _timing.totalMs = now() - _start;
+}
+
+bool PosixTransport::connectTo(const char *host, const char *port)
+{
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo *result = nullptr;
+    if (getaddrinfo(host, port, &hints, &result) != 0)
+    {
+        fprintf(stderr, "[HTTP] Unable to resolve %s\n", host);
+        return false;
+    }
+
+    for (addrinfo *address = result; address != nullptr; address = address->ai_next)
+    {
+        _socket = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (_socket < 0)
+            continue;
+
+        timeval timeout = {(time_t)(_timeoutMs / 1000), (suseconds_t)((_timeoutMs % 1000) * 1000)};
+        setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(_socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+        if (connect(_socket, address->ai_addr, address->ai_addrlen) == 0)
+            break;
+
+        close(_socket);
+        _socket = -1;
+    }
+
+    freeaddrinfo(result);
+
+    if (_socket < 0)
+        fprintf(stderr, "[HTTP] Unable to connect to %s:%s\n", host, port);
+
+    return _socket >= 0;
+}
+
+bool PosixTransport::sendAll(const char *data, size_t length)
+{
+    while (length > 0)
+    {
+        const ssize_t sent = send(_socket, data, length, 0);
+        if (sent <= 0)
+            return false;
+        data += sent;
+        length -= sent;
+    }
+    return true;
+}
+
+/**
+ * Read one header line without its line ending
+ * @return false if the connection closed before a line ending was found
+ */
+bool PosixTransport::readLine(char *line, size_t length)
+{
+    size_t position = 0;
+
+    while (true)
+    {
+        if (_bufferPos == _bufferLength && fill() <= 0)
+            return false;
+
+        const char c = _buffer[_bufferPos++];
+        if (c == '\n')
+            break;
+        if (c != '\r' && position < length - 1)
+            line[position++] = c;
+    }
+
+    line[position] = '\0';
+    return true;
+}
+
+int PosixTransport::fill()
+{
+    const ssize_t received = recv(_socket, _buffer, BufferSize, 0);
+    _bufferPos = 0;
+    _bufferLength = received > 0 ? received : 0;
+    return (int)received;
+}
+
+uint32_t PosixTransport::now()
+{
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint32_t)(time.tv_sec * 1000 + time.tv_nsec / 1000000);
+}
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Plain HTTP/1.0 transport on POSIX sockets. Used to run the fetch
+ *              and parse path on a development machine against a local
+ *              stand-in for the GitHub API.
+ */
+
+#pragma once
+
+#ifndef ARDUINO
+
+#include "HTTPTransport.h"
+
+class PosixTransport : public HTTPTransport
+{
+public:
+    explicit PosixTransport(const uint32_t timeoutMs = 10000);
+    ~PosixTransport() override;
+
+    int begin(const HTTPRequest &request) override;
+    const char *header(const char *name) const override;
+    int contentLength() const override;
+    int read() override;
+    size_t readBytes(char *buffer, size_t length) override;
+    void end() override;
+
+private:
+    static constexpr size_t BufferSize = 1024;
+
+    bool connectTo(const char *host, const char *port);
+    bool sendAll(const char *data, size_t length);
+    bool readLine(char *line, size_t length);
+    int fill();
+    static uint32_t now();
+
+    uint32_t _timeoutMs;
+    int _socket = -1;
+    int _contentLength = -1;
+    int _remaining = -1;
+    uint32_t _start = 0;
+    char _buffer[BufferSize];
+    size_t _bufferPos = 0;
+    size_t _bufferLength = 0;
+    char _headerValues[CollectedHeaderCount][HeaderValueLength] = {};
+};
+
+#endif
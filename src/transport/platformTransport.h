@@ -0,0 +1,16 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Selects the HTTP transport implementation for the build target
+ */
+
+#pragma once
+
+#ifdef ARDUINO
+#include "ESP32Transport.h"
+using PlatformTransport = ESP32Transport;
+#else
+#include "PosixTransport.h"
+using PlatformTransport = PosixTransport;
+#endif
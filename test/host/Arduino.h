@@ -0,0 +1,127 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Minimal stand-in for the Arduino core so that hardware
+ *              independent sources build in the native test environment.
+ *              Heap figures of ESP can be set by a test.
+ */
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+// The ESP32 core pulls in the FreeRTOS task API with Arduino.h
+#include "freertos/task.h"
+
+#define RTC_DATA_ATTR
+#define PROGMEM
+#define HIGH 1
+#define LOW 0
+
+using std::max;
+using std::min;
+
+inline uint32_t millis()
+{
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline uint64_t micros()
+{
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline void setCpuFrequencyMhz(const uint32_t) {}
+
+// Voltage returned by every ADC pin, set by a test
+inline uint32_t simulatedMilliVolts = 0;
+inline uint32_t analogReadMilliVolts(const uint8_t) { return simulatedMilliVolts; }
+
+inline void delay(const uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+inline size_t strlcpy(char *destination, const char *source, const size_t size)
+{
+    const size_t length = strlen(source);
+    if (size > 0)
+    {
+        const size_t copied = length < size - 1 ? length : size - 1;
+        memcpy(destination, source, copied);
+        destination[copied] = '\0';
+    }
+    return length;
+}
+#endif
+
+class String
+{
+public:
+    String(const char *text = "") : _text(text != nullptr ? text : "") {}
+    const char *c_str() const { return _text.c_str(); }
+    size_t length() const { return _text.size(); }
+    bool operator==(const char *text) const { return _text == text; }
+
+private:
+    std::string _text;
+};
+
+struct HardwareSerial
+{
+    template <typename... Args>
+    int printf(const char *format, Args... args) { return ::printf(format, args...); }
+    void print(const char *text) { fputs(text, stdout); }
+    void println(const char *text = "") { puts(text); }
+    void begin(const unsigned long) {}
+    void flush() { fflush(stdout); }
+};
+
+inline HardwareSerial Serial;
+
+struct EspClass
+{
+    uint32_t freeHeap = 200000;
+    uint32_t maxAllocHeap = 110000;
+    uint32_t minFreeHeap = 150000;
+
+    uint32_t getFreeHeap() const { return freeHeap; }
+    uint32_t getMaxAllocHeap() const { return maxAllocHeap; }
+    uint32_t getMinFreeHeap() const { return minFreeHeap; }
+};
+
+inline EspClass ESP;
+
+inline uint32_t esp_get_minimum_free_heap_size() { return ESP.minFreeHeap; }
+
+// Stack high water mark reported for every task, set by a test
+inline uint32_t simulatedStackFree = 4096;
+inline uint32_t uxTaskGetStackHighWaterMark(void *) { return simulatedStackFree; }
+
+// Critical sections of the ESP32 port as a spin lock
+struct portMUX_TYPE
+{
+    std::atomic_flag flag = ATOMIC_FLAG_INIT;
+};
+
+#define portMUX_INITIALIZER_UNLOCKED portMUX_TYPE()
+#define portENTER_CRITICAL(mux)                                       \
+    while ((mux)->flag.test_and_set(std::memory_order_acquire)) \
+    {                                                                 \
+    }
+#define portEXIT_CRITICAL(mux) (mux)->flag.clear(std::memory_order_release)
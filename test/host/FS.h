@@ -0,0 +1,67 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: In-memory stand-in for the File class of the Arduino FS
+ *              library, backed by the files of the LittleFS stand-in
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+// Write calls through any File, read by a test to count flash writes
+inline uint32_t simulatedFlashWrites = 0;
+
+class File
+{
+public:
+    File() = default;
+    File(std::vector<uint8_t> *data, const bool writable, const size_t position)
+        : _data(data), _writable(writable), _position(position) {}
+
+    explicit operator bool() const { return _data != nullptr; }
+
+    size_t size() const { return _data != nullptr ? _data->size() : 0; }
+    size_t position() const { return _position; }
+
+    bool seek(const uint32_t position)
+    {
+        if (_data == nullptr || position > _data->size())
+            return false;
+        _position = position;
+        return true;
+    }
+
+    size_t read(uint8_t *buffer, const size_t length)
+    {
+        if (_data == nullptr || _position >= _data->size())
+            return 0;
+        const size_t count = length < _data->size() - _position ? length : _data->size() - _position;
+        memcpy(buffer, _data->data() + _position, count);
+        _position += count;
+        return count;
+    }
+
+    size_t write(const uint8_t *buffer, const size_t length)
+    {
+        if (_data == nullptr || !_writable)
+            return 0;
+        simulatedFlashWrites++;
+        if (_position + length > _data->size())
+            _data->resize(_position + length);
+        memcpy(_data->data() + _position, buffer, length);
+        _position += length;
+        return length;
+    }
+
+    void close() { _data = nullptr; }
+
+private:
+    std::vector<uint8_t> *_data = nullptr;
+    bool _writable = false;
+    size_t _position = 0;
+};
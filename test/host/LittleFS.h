@@ -0,0 +1,55 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: In-memory stand-in for LittleFS. Files outlive the File
+ *              objects like in flash, a test can wipe them with
+ *              LittleFSFS::erase().
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "FS.h"
+
+class LittleFSFS
+{
+public:
+    bool begin(const bool formatOnFail = false)
+    {
+        (void)formatOnFail;
+        return true;
+    }
+
+    bool exists(const char *path) const { return files().count(path) > 0; }
+
+    bool remove(const char *path) { return files().erase(path) > 0; }
+
+    // Modes "r", "r+", "w" and "a" like fopen
+    File open(const char *path, const char *mode = "r")
+    {
+        const bool create = mode[0] == 'w' || mode[0] == 'a';
+        if (!create && !exists(path))
+            return File();
+
+        std::vector<uint8_t> &data = files()[path];
+        if (mode[0] == 'w')
+            data.clear();
+
+        const bool writable = create || mode[1] == '+';
+        return File(&data, writable, mode[0] == 'a' ? data.size() : 0);
+    }
+
+    static void erase() { files().clear(); }
+
+private:
+    static std::map<std::string, std::vector<uint8_t>> &files()
+    {
+        static std::map<std::string, std::vector<uint8_t>> files;
+        return files;
+    }
+};
+
+inline LittleFSFS LittleFS;
@@ -0,0 +1,96 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: In-memory stand-in for the NVS backed Preferences class.
+ *              The stored values outlive the object like in flash, a test
+ *              can wipe them with Preferences::erase().
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+
+class Preferences
+{
+public:
+    bool begin(const char *name, const bool readOnly = false)
+    {
+        _space = &storage()[name];
+        _readOnly = readOnly;
+        return true;
+    }
+
+    void end() { _space = nullptr; }
+
+    bool clear()
+    {
+        if (_space == nullptr || _readOnly)
+            return false;
+        _space->clear();
+        return true;
+    }
+
+    bool remove(const char *key)
+    {
+        if (_space == nullptr || _readOnly)
+            return false;
+        return _space->erase(key) > 0;
+    }
+
+    bool isKey(const char *key) const { return _space != nullptr && _space->count(key) > 0; }
+
+    uint8_t getUChar(const char *key, const uint8_t fallback = 0) const
+    {
+        const std::string *value = find(key);
+        return value != nullptr ? (uint8_t)std::stoul(*value) : fallback;
+    }
+
+    size_t putUChar(const char *key, const uint8_t value) { return put(key, std::to_string(value)) ? 1 : 0; }
+
+    size_t getString(const char *key, char *value, const size_t maxLength) const
+    {
+        const std::string *stored = find(key);
+        if (stored == nullptr || stored->size() + 1 > maxLength)
+            return 0;
+        memcpy(value, stored->c_str(), stored->size() + 1);
+        return stored->size() + 1;
+    }
+
+    size_t putString(const char *key, const char *value) { return put(key, value) ? strlen(value) : 0; }
+
+    // Wipe every namespace, as if the flash was erased
+    static void erase() { storage().clear(); }
+
+private:
+    using Space = std::map<std::string, std::string>;
+
+    static std::map<std::string, Space> &storage()
+    {
+        static std::map<std::string, Space> spaces;
+        return spaces;
+    }
+
+    const std::string *find(const char *key) const
+    {
+        if (_space == nullptr)
+            return nullptr;
+        const auto entry = _space->find(key);
+        return entry != _space->end() ? &entry->second : nullptr;
+    }
+
+    bool put(const char *key, const std::string &value)
+    {
+        if (_space == nullptr || _readOnly)
+            return false;
+        (*_space)[key] = value;
+        return true;
+    }
+
+    Space *_space = nullptr;
+    bool _readOnly = false;
+};
@@ -0,0 +1,321 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Local stand-in for the GitHub API used by the native tests.
+ *              Replays recorded responses over plain HTTP on 127.0.0.1 with
+ *              configurable latency, bandwidth and injected errors. Responses
+ *              can also be generated per request, e.g. for paginated scans.
+ */
+
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Recording
+{
+    const char *method;
+    const char *path;
+    int status;
+    const char *headers; // Extra response headers, each ending in \r\n
+    const char *body;
+};
+
+struct ReplayOptions
+{
+    uint32_t latencyMs = 0;     // Delay before the status line
+    uint32_t jitterMs = 0;      // Random extra delay up to this value
+    uint32_t bytesPerSecond = 0; // Body bandwidth, 0 is unlimited
+    uint8_t errorPercent = 0;   // Requests answered with 502
+    uint8_t dropPercent = 0;    // Requests whose body is cut off halfway
+    uint32_t seed = 1;
+};
+
+class ReplayServer
+{
+public:
+    // Builds the response body for a request body, used when no recording matches
+    using Generator = std::function<std::string(const std::string &path, const std::string &body)>;
+
+    ReplayServer(const Recording *recordings, const size_t count, const ReplayOptions &options = ReplayOptions())
+        : _recordings(recordings), _count(count), _options(options), _random(options.seed)
+    {
+    }
+
+    ~ReplayServer() { stop(); }
+
+    void setGenerator(Generator generator) { _generator = generator; }
+
+    /**
+     * Listen on an ephemeral port of 127.0.0.1
+     * @return false if the socket could not be opened
+     */
+    bool start()
+    {
+        _socket = socket(AF_INET, SOCK_STREAM, 0);
+        if (_socket < 0)
+            return false;
+
+        const int reuse = 1;
+        setsockopt(_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+
+        if (bind(_socket, (sockaddr *)&address, sizeof(address)) != 0 || listen(_socket, 16) != 0 ||
+            getsockname(_socket, (sockaddr *)&address, &length) != 0)
+        {
+            close(_socket);
+            _socket = -1;
+            return false;
+        }
+
+        _port = ntohs(address.sin_port);
+        _running = true;
+        _thread = std::thread(&ReplayServer::serve, this);
+        return true;
+    }
+
+    void stop()
+    {
+        if (!_running)
+            return;
+
+        _running = false;
+        _thread.join();
+        for (std::thread &worker : _workers)
+            worker.join();
+        _workers.clear();
+        close(_socket);
+        _socket = -1;
+    }
+
+    std::string url(const char *path) const
+    {
+        return "http://127.0.0.1:" + std::to_string(_port) + path;
+    }
+
+    uint32_t requests() const { return _requests; }
+    uint32_t errors() const { return _errors; }
+    uint32_t drops() const { return _drops; }
+
+    std::string lastRequestBody()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _lastBody;
+    }
+
+private:
+    enum class Fault
+    {
+        None,
+        Error,
+        Drop
+    };
+
+    void serve()
+    {
+        while (_running)
+        {
+            pollfd descriptor = {_socket, POLLIN, 0};
+            if (poll(&descriptor, 1, 20) <= 0)
+                continue;
+
+            const int client = accept(_socket, nullptr, nullptr);
+            if (client >= 0)
+                _workers.emplace_back(&ReplayServer::handle, this, client, nextFault(), nextDelay());
+        }
+    }
+
+    Fault nextFault()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const uint32_t roll = _random() % 100;
+        if (roll < _options.errorPercent)
+            return Fault::Error;
+        if (roll < (uint32_t)_options.errorPercent + _options.dropPercent)
+            return Fault::Drop;
+        return Fault::None;
+    }
+
+    uint32_t nextDelay()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _options.latencyMs + (_options.jitterMs > 0 ? _random() % (_options.jitterMs + 1) : 0);
+    }
+
+    void handle(const int client, const Fault fault, const uint32_t delayMs)
+    {
+        std::string method, path, body;
+        if (readRequest(client, method, path, body))
+        {
+            _requests++;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _lastBody = body;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+            respond(client, method, path, body, fault);
+        }
+        close(client);
+    }
+
+    static bool readRequest(const int client, std::string &method, std::string &path, std::string &body)
+    {
+        std::string data;
+        char buffer[1024];
+        size_t headerEnd;
+
+        while ((headerEnd = data.find("\r\n\r\n")) == std::string::npos)
+        {
+            const ssize_t received = recv(client, buffer, sizeof(buffer), 0);
+            if (received <= 0)
+                return false;
+            data.append(buffer, received);
+        }
+
+        const size_t methodEnd = data.find(' ');
+        const size_t pathEnd = data.find(' ', methodEnd + 1);
+        method = data.substr(0, methodEnd);
+        path = data.substr(methodEnd + 1, pathEnd - methodEnd - 1);
+
+        size_t contentLength = 0;
+        const size_t field = data.find("Content-Length: ");
+        if (field != std::string::npos && field < headerEnd)
+            contentLength = strtoul(data.c_str() + field + 16, nullptr, 10);
+
+        body = data.substr(headerEnd + 4);
+        while (body.size() < contentLength)
+        {
+            const ssize_t received = recv(client, buffer, sizeof(buffer), 0);
+            if (received <= 0)
+                return false;
+            body.append(buffer, received);
+        }
+        return true;
+    }
+
+    void respond(const int client, const std::string &method, const std::string &path, const std::string &request, const Fault fault)
+    {
+        int status = 404;
+        const char *headers = "";
+        std::string body = "{\"message\":\"Not Found\"}";
+
+        const Recording *recording = find(method, path);
+        if (recording != nullptr)
+        {
+            status = recording->status;
+            headers = recording->headers;
+            body = recording->body;
+        }
+        else if (_generator)
+        {
+            status = 200;
+            body = _generator(path, request);
+        }
+
+        if (fault == Fault::Error)
+        {
+            _errors++;
+            status = 502;
+            headers = "";
+            body = "{\"message\":\"Server Error\"}";
+        }
+
+        char head[256];
+        snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\nDate: Sun, 18 Oct 2026 09:00:00 GMT\r\nContent-Type: application/json\r\nContent-Length: %zu\r\nConnection: close\r\n",
+                 status, status == 200 ? "OK" : "Error", body.size());
+
+        std::string response = std::string(head) + headers + "\r\n";
+        if (!sendAll(client, response.data(), response.size()))
+            return;
+
+        size_t length = body.size();
+        if (fault == Fault::Drop)
+        {
+            _drops++;
+            length /= 2;
+        }
+        sendBody(client, body.data(), length);
+    }
+
+    const Recording *find(const std::string &method, const std::string &path) const
+    {
+        for (size_t i = 0; i < _count; i++)
+        {
+            if (method == _recordings[i].method && path == _recordings[i].path)
+                return &_recordings[i];
+        }
+        return nullptr;
+    }
+
+    void sendBody(const int client, const char *data, size_t length) const
+    {
+        if (_options.bytesPerSecond == 0)
+        {
+            sendAll(client, data, length);
+            return;
+        }
+
+        // Chunks of 10 ms worth of bandwidth
+        const size_t chunk = _options.bytesPerSecond / 100 > 0 ? _options.bytesPerSecond / 100 : 1;
+        while (length > 0)
+        {
+            const size_t part = length < chunk ? length : chunk;
+            if (!sendAll(client, data, part))
+                return;
+            data += part;
+            length -= part;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    static bool sendAll(const int client, const char *data, size_t length)
+    {
+        while (length > 0)
+        {
+            const ssize_t sent = send(client, data, length, MSG_NOSIGNAL);
+            if (sent <= 0)
+                return false;
+            data += sent;
+            length -= sent;
+        }
+        return true;
+    }
+
+    const Recording *_recordings;
+    size_t _count;
+    ReplayOptions _options;
+    Generator _generator;
+
+    std::mt19937 _random;
+    std::mutex _mutex;
+    std::string _lastBody;
+
+    int _socket = -1;
+    uint16_t _port = 0;
+    std::atomic<bool> _running{false};
+    std::atomic<uint32_t> _requests{0};
+    std::atomic<uint32_t> _errors{0};
+    std::atomic<uint32_t> _drops{0};
+    std::thread _thread;
+    std::vector<std::thread> _workers;
+};
@@ -0,0 +1,71 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: FreeRTOS event groups on top of a mutex and a condition
+ *              variable for the native test environment
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "FreeRTOS.h"
+
+typedef uint32_t EventBits_t;
+
+struct EventGroup
+{
+    std::mutex mutex;
+    std::condition_variable changed;
+    EventBits_t bits = 0;
+};
+
+typedef EventGroup *EventGroupHandle_t;
+
+inline EventGroupHandle_t xEventGroupCreate()
+{
+    return new EventGroup();
+}
+
+inline EventBits_t xEventGroupSetBits(EventGroupHandle_t group, const EventBits_t bits)
+{
+    std::lock_guard<std::mutex> lock(group->mutex);
+    group->bits |= bits;
+    group->changed.notify_all();
+    return group->bits;
+}
+
+inline EventBits_t xEventGroupClearBits(EventGroupHandle_t group, const EventBits_t bits)
+{
+    std::lock_guard<std::mutex> lock(group->mutex);
+    const EventBits_t previous = group->bits;
+    group->bits &= ~bits;
+    return previous;
+}
+
+inline EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    std::lock_guard<std::mutex> lock(group->mutex);
+    return group->bits;
+}
+
+inline EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, const EventBits_t bits, const BaseType_t clear,
+                                       const BaseType_t all, const TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(group->mutex);
+    const auto satisfied = [&]()
+    { return all ? (group->bits & bits) == bits : (group->bits & bits) != 0; };
+
+    if (ticks == portMAX_DELAY)
+        group->changed.wait(lock, satisfied);
+    else
+        group->changed.wait_for(lock, std::chrono::milliseconds(ticks), satisfied);
+
+    const EventBits_t result = group->bits;
+    if (clear && satisfied())
+        group->bits &= ~bits;
+    return result;
+}
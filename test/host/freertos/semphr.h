@@ -0,0 +1,60 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Counting semaphores of FreeRTOS on a mutex and a condition
+ *              variable for the native tests
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include "FreeRTOS.h"
+
+struct Semaphore
+{
+    std::mutex mutex;
+    std::condition_variable changed;
+    uint32_t count;
+    uint32_t maximum;
+};
+
+typedef Semaphore *SemaphoreHandle_t;
+
+inline SemaphoreHandle_t xSemaphoreCreateCounting(const uint32_t maximum, const uint32_t initial)
+{
+    return new Semaphore{{}, {}, initial, maximum};
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore)
+{
+    delete semaphore;
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+    std::lock_guard<std::mutex> lock(semaphore->mutex);
+    if (semaphore->count >= semaphore->maximum)
+        return pdFALSE;
+    semaphore->count++;
+    semaphore->changed.notify_one();
+    return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, const TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(semaphore->mutex);
+    const auto available = [&]()
+    { return semaphore->count > 0; };
+
+    if (ticks == portMAX_DELAY)
+        semaphore->changed.wait(lock, available);
+    else if (!semaphore->changed.wait_for(lock, std::chrono::milliseconds(ticks), available))
+        return pdFALSE;
+
+    semaphore->count--;
+    return pdTRUE;
+}
@@ -0,0 +1,42 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: FreeRTOS tasks as detached threads for the native tests.
+ *              Stack size and priority are ignored, a test can make task
+ *              creation fail like on an exhausted heap.
+ */
+
+#pragma once
+
+#include <thread>
+
+#include "FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+// Set by a test to refuse new tasks
+inline bool simulatedTaskFailure = false;
+
+inline BaseType_t xTaskCreate(TaskFunction_t function, const char *name, const uint32_t stack, void *parameter,
+                              const uint32_t priority, TaskHandle_t *handle)
+{
+    (void)name;
+    (void)stack;
+    (void)priority;
+
+    if (simulatedTaskFailure)
+        return pdFAIL;
+
+    std::thread(function, parameter).detach();
+    if (handle != nullptr)
+        *handle = nullptr;
+    return pdPASS;
+}
+
+// Returning from the task function ends the thread
+inline void vTaskDelete(TaskHandle_t task)
+{
+    (void)task;
+}
@@ -0,0 +1,14 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Placeholder credentials for the native tests
+ */
+
+#pragma once
+
+#define WIFI_SSID "test"
+#define WIFI_PASSWORD "test"
+#define GITHUB_USERNAME "octocat"
+#define GITHUB_PAT "ghp_test"
+#define GITHUB_TEAM "hubot", "monalisa"
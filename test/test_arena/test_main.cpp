@@ -0,0 +1,114 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Checks that the wake arena reuses released and moved blocks,
+ *              e.g. when two documents grow their buffers in turns.
+ */
+
+#include <unity.h>
+
+#include "memory/Arena.h"
+
+static Arena arena;
+
+void setUp()
+{
+    arena.reset();
+}
+
+void tearDown() {}
+
+void test_last_block_grows_in_place()
+{
+    char *text = static_cast<char *>(arena.allocate(16));
+    strcpy(text, "in place");
+    const size_t used = arena.used();
+
+    TEST_ASSERT_EQUAL_PTR(text, arena.reallocate(text, 256));
+    TEST_ASSERT_EQUAL_STRING("in place", text);
+    TEST_ASSERT_TRUE(arena.used() > used);
+}
+
+void test_moved_block_is_reused()
+{
+    char *first = static_cast<char *>(arena.allocate(64));
+    char *second = static_cast<char *>(arena.allocate(64));
+    strcpy(first, "first");
+
+    // first is not the last block and has to move, its old space is freed
+    char *grown = static_cast<char *>(arena.reallocate(first, 128));
+    TEST_ASSERT_NOT_EQUAL(first, grown);
+    TEST_ASSERT_EQUAL_STRING("first", grown);
+    TEST_ASSERT_EQUAL_size_t(64, arena.released());
+
+    TEST_ASSERT_EQUAL_PTR(first, arena.allocate(48));
+    TEST_ASSERT_EQUAL_size_t(0, arena.released());
+    TEST_ASSERT_NOT_NULL(second);
+}
+
+void test_interleaved_growth_stays_bounded()
+{
+    // Two buffers doubling in turns, as two documents parsed by parallel jobs
+    void *a = arena.allocate(32);
+    void *b = arena.allocate(32);
+    size_t size = 32;
+
+    while (size < 2048)
+    {
+        size *= 2;
+        a = arena.reallocate(a, size);
+        b = arena.reallocate(b, size);
+        TEST_ASSERT_NOT_NULL(a);
+        TEST_ASSERT_NOT_NULL(b);
+    }
+
+    // Without reuse every step would leak its previous buffer
+    arena.release(a);
+    arena.release(b);
+    for (int round = 0; round < 50; round++)
+    {
+        void *x = arena.allocate(2048);
+        void *y = arena.allocate(1024);
+        TEST_ASSERT_NOT_NULL(x);
+        TEST_ASSERT_NOT_NULL(y);
+        arena.release(y);
+        arena.release(x);
+    }
+
+    TEST_ASSERT_TRUE(arena.highWater() < 16 * 1024);
+}
+
+void test_releasing_the_last_block_rolls_back()
+{
+    arena.allocate(100);
+    const size_t used = arena.used();
+    void *last = arena.allocate(500);
+    arena.release(last);
+    TEST_ASSERT_EQUAL_size_t(used, arena.used());
+    TEST_ASSERT_EQUAL_size_t(0, arena.released());
+}
+
+void test_exhausted_arena_keeps_block()
+{
+    char *first = static_cast<char *>(arena.allocate(64));
+    arena.allocate(64);
+    strcpy(first, "kept");
+
+    TEST_ASSERT_NULL(arena.reallocate(first, arena.capacity()));
+    TEST_ASSERT_EQUAL_STRING("kept", first);
+    TEST_ASSERT_EQUAL_size_t(0, arena.released());
+}
+
+int main()
+{
+    arena.begin(32 * 1024);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_last_block_grows_in_place);
+    RUN_TEST(test_moved_block_is_reused);
+    RUN_TEST(test_interleaved_growth_stays_bounded);
+    RUN_TEST(test_releasing_the_last_block_rolls_back);
+    RUN_TEST(test_exhausted_arena_keeps_block);
+    return UNITY_END();
+}
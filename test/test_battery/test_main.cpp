@@ -0,0 +1,88 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Feeds simulated battery voltages over consecutive wakes and
+ *              checks the charging detection and the sleep policy.
+ */
+
+#include <unity.h>
+
+#include "power/Battery.h"
+
+static time_t now = 1760000000;
+
+// One wake with the battery at the given voltage
+static void wake(const uint16_t mv)
+{
+    simulatedMilliVolts = (uint32_t)(mv / PowerConfig::DividerRatio);
+    Battery::measure(now);
+    now += 3600;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_discharging()
+{
+    for (uint16_t mv = 3800; mv > 3700; mv -= 10)
+    {
+        wake(mv);
+        TEST_ASSERT_TRUE(Battery::isPresent());
+        TEST_ASSERT_FALSE(Battery::isCharging());
+    }
+    TEST_ASSERT_TRUE(Battery::isLow());
+}
+
+void test_charging_lasts_while_the_voltage_is_flat()
+{
+    wake(3760);
+    TEST_ASSERT_TRUE(Battery::isCharging());
+    TEST_ASSERT_FALSE(Battery::isLow());
+
+    // Constant voltage phase of the charger, no rise from wake to wake
+    wake(4100);
+    wake(4200);
+    for (uint8_t i = 0; i < 10; i++)
+    {
+        wake(4200 - i % 2 * 10);
+        TEST_ASSERT_TRUE(Battery::isCharging());
+    }
+}
+
+void test_unplugging_ends_charging()
+{
+    wake(4180);
+    TEST_ASSERT_TRUE(Battery::isCharging());
+    wake(4160);
+    TEST_ASSERT_FALSE(Battery::isCharging());
+    wake(4150);
+    TEST_ASSERT_FALSE(Battery::isCharging());
+}
+
+void test_sleep_is_stretched_when_critical()
+{
+    wake(3600);
+    TEST_ASSERT_TRUE(Battery::isCritical());
+    TEST_ASSERT_EQUAL_UINT64(3600ULL * 1000000 * PowerConfig::CriticalIntervalFactor,
+                             Battery::adjustSleep(3600ULL * 1000000));
+}
+
+void test_missing_battery()
+{
+    wake(0);
+    TEST_ASSERT_FALSE(Battery::isPresent());
+    TEST_ASSERT_FALSE(Battery::isCharging());
+    TEST_ASSERT_FALSE(Battery::isCritical());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_discharging);
+    RUN_TEST(test_charging_lasts_while_the_voltage_is_flat);
+    RUN_TEST(test_unplugging_ends_charging);
+    RUN_TEST(test_sleep_is_stretched_when_critical);
+    RUN_TEST(test_missing_battery);
+    return UNITY_END();
+}
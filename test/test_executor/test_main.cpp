@@ -0,0 +1,288 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Runs the profile, calendar and repository jobs of a wake
+ *              through RequestExecutor against the replay server with
+ *              injected latency, one at a time and concurrently, and reports
+ *              the wall time of both.
+ */
+
+#include <unity.h>
+
+#include <string>
+
+#include "GitHub/GraphQLRequest.h"
+#include "GitHub/RateLimit.h"
+#include "GitHub/RepoParser.h"
+#include "GitHub/RequestExecutor.h"
+#include "ReplayServer.h"
+#include "transport/PosixTransport.h"
+
+static constexpr uint32_t RepoPages = 4;
+
+static const char ProfileBody[] = "{\"login\":\"octocat\",\"followers\":42,\"public_repos\":8}";
+static const char CalendarBody[] = "{\"data\":{\"user\":{\"contributionsCollection\":{}}}}";
+
+static const Recording Recordings[] = {
+    {"GET", "/users/octocat", 200,
+     "X-RateLimit-Limit: 5000\r\nX-RateLimit-Remaining: 4987\r\nX-RateLimit-Reset: 1792314000\r\nX-RateLimit-Resource: core\r\n",
+     ProfileBody}};
+
+/**
+ * GraphQL responses, the calendar or a page of the repository scan with one
+ * repository per page
+ */
+static std::string graphQL(const std::string &, const std::string &request)
+{
+    if (request.find("repositories(") == std::string::npos)
+        return CalendarBody;
+
+    uint32_t page = 0;
+    const size_t after = request.find("\"after\":\"p");
+    if (after != std::string::npos)
+        page = strtoul(request.c_str() + after + 10, nullptr, 10);
+
+    const std::string next = "\"p" + std::to_string(page + 1) + "\"";
+    return "{\"data\":{\"user\":{\"repositories\":{\"pageInfo\":{\"hasNextPage\":" +
+           std::string(page + 1 < RepoPages ? "true" : "false") + ",\"endCursor\":" + next +
+           "},\"nodes\":[{\"name\":\"repo-" + std::to_string(page) + "\",\"stargazerCount\":" +
+           std::to_string(page + 1) + ",\"forkCount\":0}]}},"
+           "\"rateLimit\":{\"cost\":1,\"remaining\":4990,\"resetAt\":\"2026-10-18T10:00:00Z\"}}}";
+}
+
+struct JobContext
+{
+    std::string base;
+    RepoSummary summary;
+    uint32_t pages = 0;
+};
+
+static bool exchange(const HTTPRequest &request, std::string &body)
+{
+    PosixTransport transport;
+    if (transport.begin(request) != 200)
+        return false;
+
+    RateLimit::update(transport);
+
+    char chunk[128];
+    size_t length;
+    while ((length = transport.readBytes(chunk, sizeof(chunk))) > 0)
+        body.append(chunk, length);
+    transport.end();
+    return true;
+}
+
+static bool fetchProfile(void *context, const uint32_t)
+{
+    const std::string url = static_cast<JobContext *>(context)->base + "/users/octocat";
+    const HTTPRequest request = {"GET", url.c_str(), nullptr, 0, nullptr, 0};
+
+    std::string body;
+    return exchange(request, body) && body == ProfileBody;
+}
+
+static bool fetchCalendar(void *context, const uint32_t)
+{
+    tm from = {}, to = {};
+    from.tm_year = to.tm_year = 2026 - 1900;
+    from.tm_mday = to.tm_mday = 18;
+    CalendarRequest query;
+    query.setRange(from, to);
+
+    const std::string url = static_cast<JobContext *>(context)->base + "/graphql";
+    const HTTPRequest request = {"POST", url.c_str(), GraphQL::Headers, 2, query.body(), query.length()};
+
+    std::string body;
+    return exchange(request, body) && body == CalendarBody;
+}
+
+// Same paging as GitHubParser::scanRepos
+static bool fetchRepos(void *context, const uint32_t deadline)
+{
+    JobContext *job = static_cast<JobContext *>(context);
+    const std::string url = job->base + "/graphql";
+
+    char cursor[64] = "";
+    for (job->pages = 0; job->pages < RepoConfig::MaxPages; job->pages++)
+    {
+        if (job->pages > 0 && RequestExecutor::passed(deadline))
+            return false;
+
+        RepoRequest query;
+        if (!query.build("octocat", job->pages == 0 ? nullptr : cursor))
+            return false;
+
+        const HTTPRequest request = {"POST", url.c_str(), GraphQL::Headers, 2, query.body(), query.length()};
+        std::string body;
+        if (!exchange(request, body))
+            return false;
+
+        RepoParser parser(job->summary);
+        parser.feed(body.data(), body.size());
+        if (!parser.ok())
+            return false;
+        if (parser.cost() > 0)
+            RateLimit::updateGraphQL(parser.cost(), parser.remaining(), parser.resetAt());
+
+        if (!parser.hasNextPage())
+        {
+            job->pages++;
+            job->summary.finish();
+            return true;
+        }
+        strlcpy(cursor, parser.endCursor(), sizeof(cursor));
+    }
+    return false;
+}
+
+struct Wake
+{
+    JobContext profile, calendar, repos;
+    FetchJob jobs[3];
+};
+
+static void prepare(Wake &wake, const ReplayServer &server)
+{
+    const std::string base = server.url("");
+    wake.profile.base = wake.calendar.base = wake.repos.base = base;
+
+    wake.jobs[0].name = "profile";
+    wake.jobs[0].run = fetchProfile;
+    wake.jobs[0].context = &wake.profile;
+    wake.jobs[1].name = "calendar";
+    wake.jobs[1].run = fetchCalendar;
+    wake.jobs[1].context = &wake.calendar;
+    wake.jobs[2].name = "repos";
+    wake.jobs[2].run = fetchRepos;
+    wake.jobs[2].context = &wake.repos;
+}
+
+static uint32_t runWake(const ReplayServer &server, const uint8_t parallel, const uint32_t deadline, Wake &wake)
+{
+    prepare(wake, server);
+    RequestExecutor executor(parallel);
+
+    const uint32_t start = millis();
+    executor.run(wake.jobs, 3, deadline);
+    return millis() - start;
+}
+
+static ReplayOptions delayed()
+{
+    ReplayOptions options;
+    options.latencyMs = 80;
+    options.jitterMs = 20;
+    options.seed = 27;
+    return options;
+}
+
+void setUp()
+{
+    ESP.freeHeap = 200000;
+    ESP.maxAllocHeap = 110000;
+    simulatedTaskFailure = false;
+}
+
+void tearDown() {}
+
+void test_concurrent_jobs_beat_serial()
+{
+    ReplayServer server(Recordings, 1, delayed());
+    server.setGenerator(graphQL);
+    TEST_ASSERT_TRUE(server.start());
+
+    Wake serial;
+    const uint32_t serialMs = runWake(server, 1, Network::RequestDeadline, serial);
+    Wake concurrent;
+    const uint32_t concurrentMs = runWake(server, 3, Network::RequestDeadline, concurrent);
+
+    for (const Wake *wake : {&serial, &concurrent})
+    {
+        for (const FetchJob &job : wake->jobs)
+        {
+            TEST_ASSERT_TRUE(job.started);
+            TEST_ASSERT_TRUE(job.ok);
+        }
+        TEST_ASSERT_EQUAL_UINT32(RepoPages, wake->repos.pages);
+        TEST_ASSERT_EQUAL_UINT32(RepoPages, wake->repos.summary.repos());
+    }
+    TEST_ASSERT_EQUAL_UINT32(2 * (RepoPages + 2), server.requests());
+
+    // The profile and the calendar overlap with the scan
+    TEST_ASSERT_TRUE(concurrentMs < serialMs * 3 / 4);
+
+    char report[120];
+    snprintf(report, sizeof(report), "3 jobs, %u requests: serial %u ms, concurrent %u ms",
+             (unsigned)(RepoPages + 2), (unsigned)serialMs, (unsigned)concurrentMs);
+    TEST_MESSAGE(report);
+}
+
+void test_low_heap_runs_one_at_a_time()
+{
+    ReplayServer server(Recordings, 1, delayed());
+    server.setGenerator(graphQL);
+    TEST_ASSERT_TRUE(server.start());
+
+    // Not enough heap for a second TLS connection
+    ESP.freeHeap = Network::RequestHeapBudget - 1;
+
+    Wake wake;
+    const uint32_t wallMs = runWake(server, 3, Network::RequestDeadline, wake);
+
+    uint32_t sequential = 0;
+    for (const FetchJob &job : wake.jobs)
+    {
+        TEST_ASSERT_TRUE(job.ok);
+        sequential += job.durationMs;
+    }
+    TEST_ASSERT_TRUE(wallMs >= sequential);
+}
+
+void test_failed_task_runs_inline()
+{
+    ReplayServer server(Recordings, 1);
+    server.setGenerator(graphQL);
+    TEST_ASSERT_TRUE(server.start());
+
+    simulatedTaskFailure = true;
+
+    Wake wake;
+    runWake(server, 3, Network::RequestDeadline, wake);
+    for (const FetchJob &job : wake.jobs)
+        TEST_ASSERT_TRUE(job.ok);
+}
+
+void test_deadline_stops_jobs()
+{
+    ReplayServer server(Recordings, 1, delayed());
+    server.setGenerator(graphQL);
+    TEST_ASSERT_TRUE(server.start());
+
+    // One at a time, the deadline passes during the calendar request
+    Wake wake;
+    const uint32_t wallMs = runWake(server, 1, 150, wake);
+
+    TEST_ASSERT_TRUE(wake.jobs[0].ok);
+    TEST_ASSERT_TRUE(wake.jobs[1].started);
+    TEST_ASSERT_FALSE(wake.jobs[2].started);
+    TEST_ASSERT_FALSE(wake.jobs[2].ok);
+    TEST_ASSERT_TRUE(wallMs < 150 + 2 * (delayed().latencyMs + delayed().jitterMs));
+
+    // A running scan stops paging once the deadline passed
+    Wake concurrent;
+    runWake(server, 3, 150, concurrent);
+    TEST_ASSERT_FALSE(concurrent.jobs[2].ok);
+    TEST_ASSERT_TRUE(concurrent.repos.pages < RepoPages);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_concurrent_jobs_beat_serial);
+    RUN_TEST(test_low_heap_runs_one_at_a_time);
+    RUN_TEST(test_failed_task_runs_inline);
+    RUN_TEST(test_deadline_stops_jobs);
+    return UNITY_END();
+}
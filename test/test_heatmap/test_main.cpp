@@ -0,0 +1,176 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Checks the count to gray level mapping of HeatmapScale in all
+ *              three modes
+ */
+
+#include <unity.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "display/HeatmapScale.h"
+
+using HeatmapConfig::MaxLevel;
+using HeatmapConfig::MinLevel;
+using HeatmapConfig::Mode;
+
+// The whole calendar, 53 weeks
+static constexpr size_t Days = 372;
+
+void setUp() {}
+void tearDown() {}
+
+static void assertMonotonic(const HeatmapScale &scale, const uint16_t max)
+{
+    uint8_t previous = scale.level(0);
+    TEST_ASSERT_EQUAL_UINT8(MinLevel, previous);
+
+    for (uint32_t count = 1; count <= max; count++)
+    {
+        const uint8_t level = scale.level(count);
+        TEST_ASSERT_TRUE(level >= previous);
+        TEST_ASSERT_TRUE(level <= MaxLevel);
+        previous = level;
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(MaxLevel, scale.level(max));
+}
+
+void test_empty_calendar_stays_blank()
+{
+    const std::vector<uint16_t> counts(Days, 0);
+
+    for (const Mode mode : {Mode::Linear, Mode::Quantile, Mode::Logarithmic})
+    {
+        HeatmapScale scale;
+        scale.build(counts.data(), counts.size(), mode);
+        TEST_ASSERT_EQUAL_UINT8(MinLevel, scale.level(0));
+        TEST_ASSERT_EQUAL_UINT8(MinLevel, scale.level(1000));
+    }
+}
+
+void test_linear_matches_map()
+{
+    // Small maxima, maxima beyond the lookup table and the largest count
+    for (const uint16_t max : {1, 2, 7, 13, 14, 100, 255, 256, 1000, 40000, UINT16_MAX})
+    {
+        std::vector<uint16_t> counts(Days, 0);
+        counts[Days / 2] = max;
+
+        HeatmapScale scale;
+        scale.build(counts.data(), counts.size(), Mode::Linear);
+
+        for (uint32_t count = 0; count <= max; count += max > 2000 ? 97 : 1)
+        {
+            // map(count, 0, max, MinLevel, MaxLevel)
+            const long expected = (long)count * (MaxLevel - MinLevel) / max + MinLevel;
+            TEST_ASSERT_EQUAL_UINT8(expected, scale.level(count));
+        }
+        TEST_ASSERT_EQUAL_UINT8(MaxLevel, scale.level(max));
+    }
+}
+
+void test_quantile_ignores_outliers()
+{
+    // A steady year of 1 to 5 contributions and one day with 500
+    std::vector<uint16_t> counts(Days, 0);
+    for (size_t i = 0; i < Days; i++)
+        counts[i] = i % 3 == 0 ? 0 : 1 + i % 5;
+    counts[100] = 500;
+
+    HeatmapScale linear;
+    linear.build(counts.data(), counts.size(), Mode::Linear);
+    HeatmapScale quantile;
+    quantile.build(counts.data(), counts.size(), Mode::Quantile);
+
+    // Linear fades the usual days to the level of empty ones
+    TEST_ASSERT_EQUAL_UINT8(MinLevel, linear.level(5));
+
+    assertMonotonic(quantile, 500);
+    TEST_ASSERT_TRUE(quantile.level(1) > MinLevel);
+    TEST_ASSERT_TRUE(quantile.level(5) >= MaxLevel - 3);
+    TEST_ASSERT_TRUE(quantile.level(1) < quantile.level(3));
+    TEST_ASSERT_TRUE(quantile.level(3) < quantile.level(5));
+}
+
+void test_quantile_gives_equal_shares()
+{
+    // Every count from 1 to 130 on as many days, 10 counts per level
+    const uint8_t steps = MaxLevel - MinLevel;
+    std::vector<uint16_t> counts;
+    for (uint16_t count = 1; count <= 10 * steps; count++)
+        counts.insert(counts.end(), 2, count);
+    counts.resize(Days, 0);
+
+    HeatmapScale scale;
+    scale.build(counts.data(), counts.size(), Mode::Quantile);
+    assertMonotonic(scale, 10 * steps);
+
+    for (uint16_t count = 1; count <= 10 * steps; count++)
+        TEST_ASSERT_EQUAL_UINT8(MinLevel + (count + 9) / 10, scale.level(count));
+}
+
+void test_logarithmic_scale()
+{
+    std::vector<uint16_t> counts(Days, 0);
+    counts[0] = 1000;
+
+    HeatmapScale scale;
+    scale.build(counts.data(), counts.size(), Mode::Logarithmic);
+    assertMonotonic(scale, 1000);
+
+    // A single contribution is visible, unlike with the linear scale
+    TEST_ASSERT_TRUE(scale.level(1) > MinLevel);
+
+    // Equal ratios of 1 + count give roughly equal level steps
+    const int low = scale.level(9) - scale.level(0);
+    const int high = scale.level(999) - scale.level(99);
+    TEST_ASSERT_INT_WITHIN(1, low, scale.level(99) - scale.level(9));
+    TEST_ASSERT_INT_WITHIN(1, low, high);
+}
+
+void test_table_matches_thresholds()
+{
+    // Counts on both sides of the lookup table give the same levels as a
+    // direct comparison with the thresholds
+    std::mt19937 random(47);
+    std::uniform_int_distribution<uint32_t> contribution(0, 600);
+
+    for (const Mode mode : {Mode::Linear, Mode::Quantile, Mode::Logarithmic})
+    {
+        std::vector<uint16_t> counts(Days);
+        for (uint16_t &count : counts)
+            count = contribution(random);
+
+        HeatmapScale scale;
+        scale.build(counts.data(), counts.size(), mode);
+        assertMonotonic(scale, *std::max_element(counts.begin(), counts.end()));
+
+        // Linear may fade small counts, the others keep every active day visible
+        if (mode != Mode::Linear)
+        {
+            for (const uint16_t count : counts)
+                TEST_ASSERT_TRUE(count == 0 || scale.level(count) > MinLevel);
+        }
+
+        const uint16_t edge = HeatmapConfig::TableSize;
+        TEST_ASSERT_TRUE(scale.level(edge) >= scale.level(edge - 1));
+        TEST_ASSERT_TRUE(scale.level(edge + 1) >= scale.level(edge));
+    }
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_calendar_stays_blank);
+    RUN_TEST(test_linear_matches_map);
+    RUN_TEST(test_quantile_ignores_outliers);
+    RUN_TEST(test_quantile_gives_equal_shares);
+    RUN_TEST(test_logarithmic_scale);
+    RUN_TEST(test_table_matches_thresholds);
+    return UNITY_END();
+}
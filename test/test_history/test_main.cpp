@@ -0,0 +1,196 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Stores fetched calendars in the history file on an in-memory
+ *              LittleFS and reads them back day by day and as ranges
+ */
+
+#include <unity.h>
+
+#include <random>
+#include <vector>
+
+#include "config/timeConfig.h"
+#include "history/HistoryStore.h"
+
+static constexpr size_t CalendarDays = sizeof(GitHubStats::commits) / sizeof(GitHubStats::commits[0]);
+
+/**
+ * Calendar of the 52 weeks before the current one up to today
+ * @param count Contributions of a day, called for every day of the range
+ */
+template <typename Count>
+static GitHubStats calendar(const int32_t today, Count count)
+{
+    GitHubStats stats = {};
+    stats.startDay = TimeUtils::calendarStart(today, TimeConfig::CalendarWeeks);
+    stats.firstDay = stats.startDay;
+    for (int32_t day = stats.startDay; day <= today; day++)
+        stats.commits[day - stats.startDay] = count(day);
+    return stats;
+}
+
+static int32_t date(const int year, const int month, const int day)
+{
+    return TimeUtils::daysFromCivil(year, month, day);
+}
+
+static void assertStored(const GitHubStats &stats, const int32_t today)
+{
+    const size_t days = today - stats.firstDay + 1;
+    std::vector<uint16_t> counts(days, UINT16_MAX);
+    TEST_ASSERT_EQUAL_size_t(days, HistoryStore::read(stats.firstDay, counts.data(), days));
+
+    for (int32_t day = stats.firstDay; day <= today; day++)
+    {
+        const uint16_t expected = stats.commits[day - stats.startDay];
+        TEST_ASSERT_EQUAL_UINT16(expected, HistoryStore::get(day));
+        TEST_ASSERT_EQUAL_UINT16(expected, counts[day - stats.firstDay]);
+    }
+}
+
+void setUp()
+{
+    // begin() creates the file once, later tests zero it
+    if (!LittleFS.exists(HistoryConfig::Path))
+        return;
+
+    File file = LittleFS.open(HistoryConfig::Path, "r+");
+    const std::vector<uint8_t> zeros(file.size(), 0);
+    file.write(zeros.data(), zeros.size());
+    file.close();
+}
+
+void tearDown() {}
+
+void test_round_trip_across_new_year()
+{
+    const int32_t today = date(2026, 10, 18);
+    std::mt19937 random(44);
+    std::uniform_int_distribution<int> count(0, 14);
+
+    const GitHubStats stats = calendar(today, [&](int32_t) { return count(random); });
+    TEST_ASSERT_TRUE(HistoryStore::store(stats, today));
+    assertStored(stats, today);
+
+    // The range spans 2025 and 2026, the days before and after read as empty
+    TEST_ASSERT_TRUE(TimeUtils::yearFromDays(stats.startDay) == 2025);
+    TEST_ASSERT_EQUAL_UINT16(0, HistoryStore::get(stats.startDay - 1));
+    TEST_ASSERT_EQUAL_UINT16(0, HistoryStore::get(today + 1));
+}
+
+void test_escapes_round_trip()
+{
+    const int32_t today = date(2026, 3, 1);
+    const GitHubStats stats = calendar(today, [](int32_t day) -> uint16_t
+                                       {
+        switch (day % 9)
+        {
+        case 0: return 15;
+        case 1: return 300;
+        case 2: return UINT16_MAX;
+        default: return day % 5;
+        } });
+
+    TEST_ASSERT_TRUE(HistoryStore::store(stats, today));
+    assertStored(stats, today);
+
+    // Dropping below the escape value frees the entry, raising it adds one
+    const GitHubStats changed = calendar(today, [](int32_t day) -> uint16_t
+                                         { return day % 9 == 1 ? 3 : day % 9 == 3 ? 40 : 0; });
+    TEST_ASSERT_TRUE(HistoryStore::store(changed, today));
+    assertStored(changed, today);
+}
+
+void test_full_escape_table_caps_days()
+{
+    // More busy days in 2026 than the escape table holds
+    const int32_t today = date(2026, 10, 18);
+    const GitHubStats stats = calendar(today, [](int32_t day) -> uint16_t
+                                       { return 20 + day % 7; });
+    TEST_ASSERT_TRUE(HistoryStore::store(stats, today));
+
+    const int32_t newYear = date(2026, 1, 1);
+    uint16_t exact = 0, capped = 0;
+    for (int32_t day = newYear; day <= today; day++)
+    {
+        const uint16_t stored = HistoryStore::get(day);
+        if (stored == stats.commits[day - stats.startDay])
+            exact++;
+        else if (stored == 14)
+            capped++;
+    }
+    TEST_ASSERT_EQUAL_UINT16(HistoryConfig::MaxEscapes, exact);
+    TEST_ASSERT_EQUAL_UINT16(today - newYear + 1 - HistoryConfig::MaxEscapes, capped);
+
+    // The same calendar again must not rewrite the capped year
+    simulatedFlashWrites = 0;
+    TEST_ASSERT_TRUE(HistoryStore::store(stats, today));
+    TEST_ASSERT_EQUAL_UINT32(0, simulatedFlashWrites);
+
+    // A real change is still written
+    GitHubStats next = stats;
+    next.commits[today - stats.startDay] = 2;
+    TEST_ASSERT_TRUE(HistoryStore::store(next, today));
+    TEST_ASSERT_EQUAL_UINT32(1, simulatedFlashWrites);
+    TEST_ASSERT_EQUAL_UINT16(2, HistoryStore::get(today));
+}
+
+void test_days_before_the_range_are_kept()
+{
+    const int32_t today = date(2026, 10, 18);
+    const GitHubStats first = calendar(today, [](int32_t day) -> uint16_t
+                                       { return 1 + day % 3; });
+    TEST_ASSERT_TRUE(HistoryStore::store(first, today));
+
+    // The next fetch starts two days into its first week
+    GitHubStats next = calendar(today, [](int32_t) -> uint16_t
+                                { return 7; });
+    next.firstDay = next.startDay + 2;
+    for (int32_t day = next.startDay; day < next.firstDay; day++)
+        next.commits[day - next.startDay] = 0;
+    TEST_ASSERT_TRUE(HistoryStore::store(next, today));
+
+    TEST_ASSERT_EQUAL_UINT16(1 + next.startDay % 3, HistoryStore::get(next.startDay));
+    TEST_ASSERT_EQUAL_UINT16(7, HistoryStore::get(next.firstDay));
+
+    // A range that starts before the calendar it belongs to is rejected
+    next.firstDay = next.startDay - 1;
+    TEST_ASSERT_FALSE(HistoryStore::store(next, today));
+}
+
+void test_years_roll_over()
+{
+    const int32_t today = date(2026, 10, 18);
+    const GitHubStats old = calendar(today, [](int32_t) -> uint16_t
+                                     { return 5; });
+    TEST_ASSERT_TRUE(HistoryStore::store(old, today));
+
+    // Years later the slot of 2026 is reused for 2034
+    const int32_t later = date(2026 + HistoryConfig::Years, 10, 18);
+    const GitHubStats recent = calendar(later, [](int32_t) -> uint16_t
+                                        { return 9; });
+    TEST_ASSERT_TRUE(HistoryStore::store(recent, later));
+
+    // 2025 and 2026 shared their slots with 2033 and 2034
+    TEST_ASSERT_EQUAL_UINT16(0, HistoryStore::get(today));
+    TEST_ASSERT_EQUAL_UINT16(0, HistoryStore::get(old.startDay));
+    assertStored(recent, later);
+
+    // Storing the old calendar again takes the slots back
+    TEST_ASSERT_TRUE(HistoryStore::store(old, today));
+    TEST_ASSERT_EQUAL_UINT16(5, HistoryStore::get(today));
+    TEST_ASSERT_EQUAL_UINT16(0, HistoryStore::get(recent.startDay));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip_across_new_year);
+    RUN_TEST(test_escapes_round_trip);
+    RUN_TEST(test_full_escape_table_caps_days);
+    RUN_TEST(test_days_before_the_range_are_kept);
+    RUN_TEST(test_years_roll_over);
+    return UNITY_END();
+}
@@ -0,0 +1,71 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Runs the checkpoints of a wake with simulated heap and stack
+ *              figures and checks them against the budget of MemoryConfig.
+ */
+
+#include <unity.h>
+
+#include "profiler/MemoryTelemetry.h"
+
+// Figures of a wake that stays within the budget
+static void healthy()
+{
+    ESP.freeHeap = MemoryConfig::MinFreeHeap + 40000;
+    ESP.maxAllocHeap = MemoryConfig::MinLargestBlock + 20000;
+    simulatedStackFree = MemoryConfig::MinStackFree + 2048;
+}
+
+void setUp()
+{
+    healthy();
+}
+
+void tearDown() {}
+
+void test_wake_within_budget()
+{
+    MemoryTelemetry::sample(Checkpoint::WiFi);
+    // TLS buffers
+    ESP.freeHeap -= 30000;
+    ESP.maxAllocHeap -= 15000;
+    MemoryTelemetry::sample(Checkpoint::TLS);
+    MemoryTelemetry::sample(Checkpoint::Parse);
+    MemoryTelemetry::sample(Checkpoint::Render);
+
+    TEST_ASSERT_TRUE(MemoryTelemetry::withinBudget());
+    MemoryTelemetry::print();
+}
+
+void test_budget_edges_pass()
+{
+    MemoryTelemetry::check(Checkpoint::Parse, {MemoryConfig::MinFreeHeap, MemoryConfig::MinLargestBlock,
+                                               MemoryConfig::MinStackFree});
+    TEST_ASSERT_TRUE(MemoryTelemetry::withinBudget());
+}
+
+// Runs last, a wake never recovers from an exceeded budget
+void test_fragmented_heap_fails_budget()
+{
+    // Enough memory in total, but no block large enough for a TLS record
+    ESP.maxAllocHeap = MemoryConfig::MinLargestBlock - 1;
+    MemoryTelemetry::sample(Checkpoint::TLS);
+
+    TEST_ASSERT_FALSE(MemoryTelemetry::withinBudget());
+
+    healthy();
+    MemoryTelemetry::sample(Checkpoint::Render);
+    TEST_ASSERT_FALSE(MemoryTelemetry::withinBudget());
+    MemoryTelemetry::print();
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_wake_within_budget);
+    RUN_TEST(test_budget_edges_pass);
+    RUN_TEST(test_fragmented_heap_fails_budget);
+    return UNITY_END();
+}
@@ -0,0 +1,320 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Pages through thousands of generated repositories on the
+ *              replay server with the GraphQL repository scan and compares
+ *              the streamed summary with totals computed from the source
+ */
+
+#include <unity.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "GitHub/GraphQLRequest.h"
+#include "GitHub/RepoParser.h"
+#include "ReplayServer.h"
+#include "statistics/RepoSummary.h"
+#include "transport/PosixTransport.h"
+
+static const char *const Languages[] = {
+    "C", "C++", "Rust", "Go", "Python", "TypeScript", "JavaScript", "Java", "Kotlin", "Swift",
+    "Ruby", "PHP", "Haskell", "OCaml", "Zig", "Lua", "Shell", "Nix", "Elixir", "Scala"};
+static constexpr size_t LanguageCount = sizeof(Languages) / sizeof(Languages[0]);
+
+// Languages of a repository, largest first like the query orders them
+struct Edge
+{
+    const char *name;
+    uint32_t size;
+};
+
+static uint32_t stars(const uint32_t index) { return index * 7919 % 100003; }
+static uint32_t forks(const uint32_t index) { return index % 13; }
+static uint32_t watchers(const uint32_t index) { return index % 101; }
+
+static std::vector<Edge> edges(const uint32_t index)
+{
+    if (index % 11 == 0)
+        return {};
+    return {{Languages[index % LanguageCount], 4000 + index % 997},
+            {Languages[(index + 3) % LanguageCount], 1000 + index % 89}};
+}
+
+/**
+ * One page of the GraphQL response for the repositories after a cursor
+ * @param total Repositories of the user
+ * @param request Request body, "after" is null or "c<index>"
+ */
+static std::string repoPage(const uint32_t total, const std::string &request)
+{
+    uint32_t first = 0;
+    const size_t after = request.find("\"after\":\"c");
+    if (after != std::string::npos)
+        first = strtoul(request.c_str() + after + 10, nullptr, 10);
+    const uint32_t last = std::min<uint32_t>(first + RepoConfig::PageSize, total);
+
+    std::string body = "{\"data\":{\"user\":{\"repositories\":{\"pageInfo\":{\"hasNextPage\":";
+    body += last < total ? "true" : "false";
+    body += ",\"endCursor\":";
+    body += last > first ? "\"c" + std::to_string(last) + "\"" : "null";
+    body += "},\"nodes\":[";
+
+    for (uint32_t i = first; i < last; i++)
+    {
+        const std::vector<Edge> languages = edges(i);
+        body += i > first ? ",{" : "{";
+        body += "\"name\":\"repo-" + std::to_string(i) + "\",";
+        body += i % 7 == 0 ? "\"description\":null," : "\"description\":\"Repository number " + std::to_string(i) + "\",";
+        body += "\"stargazerCount\":" + std::to_string(stars(i)) + ",\"forkCount\":" + std::to_string(forks(i)) + ",";
+        body += languages.empty() ? "\"primaryLanguage\":null," : std::string("\"primaryLanguage\":{\"name\":\"") + languages[0].name + "\"},";
+        body += "\"licenseInfo\":{\"spdxId\":\"MIT\"},\"watchers\":{\"totalCount\":" + std::to_string(watchers(i)) + "},";
+        body += "\"languages\":{\"edges\":[";
+        for (size_t e = 0; e < languages.size(); e++)
+        {
+            body += e > 0 ? ",{" : "{";
+            body += "\"size\":" + std::to_string(languages[e].size) + ",\"node\":{\"name\":\"" + languages[e].name + "\"}}";
+        }
+        body += "]}}";
+    }
+
+    body += "]}}},\"rateLimit\":{\"cost\":1,\"remaining\":4999,\"resetAt\":\"2026-10-18T10:00:00Z\"}}}";
+    return body;
+}
+
+struct Scan
+{
+    bool ok = false;
+    uint32_t pages = 0;
+    size_t largestPage = 0;
+    size_t bytes = 0;
+};
+
+/**
+ * Same loop as GitHubParser::scanRepos, with the POSIX transport in place of
+ * the TLS client
+ */
+static Scan scanRepos(ReplayServer &server, const char *login, RepoSummary &summary)
+{
+    const std::string url = server.url("/graphql");
+    Scan scan;
+
+    char cursor[64] = "";
+    for (; scan.pages < RepoConfig::MaxPages; scan.pages++)
+    {
+        RepoRequest query;
+        if (!query.build(login, scan.pages == 0 ? nullptr : cursor))
+            return scan;
+
+        const HTTPRequest request = {"POST", url.c_str(), GraphQL::Headers, 2, query.body(), query.length()};
+        PosixTransport transport;
+        if (transport.begin(request) != 200)
+            return scan;
+
+        RepoParser parser(summary);
+        char chunk[128];
+        size_t length;
+        while ((length = transport.readBytes(chunk, sizeof(chunk))) > 0)
+            parser.feed(chunk, length);
+        transport.end();
+
+        scan.bytes += transport.timing().bytesReceived;
+        scan.largestPage = std::max<size_t>(scan.largestPage, transport.timing().bytesReceived);
+
+        if (!parser.ok())
+            return scan;
+
+        if (!parser.hasNextPage() || parser.endCursor()[0] == '\0')
+        {
+            scan.pages++;
+            summary.finish();
+            scan.ok = true;
+            return scan;
+        }
+        strlcpy(cursor, parser.endCursor(), sizeof(cursor));
+    }
+
+    // More repositories than pages, the partial totals are not used
+    return scan;
+}
+
+/**
+ * Compare a finished summary with the totals of the first repositories
+ * @param total Repositories the summary should cover
+ */
+static void assertSummary(const RepoSummary &summary, const uint32_t total)
+{
+    uint32_t starSum = 0, forkSum = 0;
+    std::vector<uint32_t> starList;
+    std::vector<std::string> seen;
+    std::map<std::string, uint64_t> bytes;
+
+    for (uint32_t i = 0; i < total; i++)
+    {
+        starSum += stars(i);
+        forkSum += forks(i);
+        starList.push_back(stars(i));
+        for (const Edge &edge : edges(i))
+        {
+            if (bytes.count(edge.name) == 0)
+                seen.push_back(edge.name);
+            bytes[edge.name] += edge.size;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(total, summary.repos());
+    TEST_ASSERT_EQUAL_UINT32(starSum, summary.stars());
+    TEST_ASSERT_EQUAL_UINT32(forkSum, summary.forks());
+
+    std::sort(starList.rbegin(), starList.rend());
+    TEST_ASSERT_EQUAL_UINT8(std::min<size_t>(RepoConfig::TopRepos, total), summary.topCount());
+    for (uint8_t i = 0; i < summary.topCount(); i++)
+    {
+        const GitHubRepo &repo = summary.top()[i];
+        TEST_ASSERT_EQUAL_INT(starList[i], repo.stargazers);
+
+        const uint32_t index = strtoul(repo.name.c_str() + strlen("repo-"), nullptr, 10);
+        TEST_ASSERT_EQUAL_UINT32(stars(index), repo.stargazers);
+        TEST_ASSERT_EQUAL_INT(watchers(index), repo.watchers);
+        TEST_ASSERT_EQUAL_STRING("MIT", repo.license.c_str());
+    }
+
+    // Languages beyond the last slot are summed as "Other"
+    uint64_t byteSum = 0, summaryBytes = 0;
+    for (const auto &language : bytes)
+        byteSum += language.second;
+
+    TEST_ASSERT_EQUAL_UINT8(std::min<size_t>(seen.size(), RepoConfig::MaxLanguages), summary.languageCount());
+    for (uint8_t i = 0; i < summary.languageCount(); i++)
+    {
+        const LanguageTotal &language = summary.languages()[i];
+        summaryBytes += language.bytes;
+        if (i > 0)
+            TEST_ASSERT_TRUE(language.bytes <= summary.languages()[i - 1].bytes);
+        if (language.name != "Other")
+            TEST_ASSERT_EQUAL_UINT64(bytes[language.name.c_str()], language.bytes);
+    }
+    TEST_ASSERT_EQUAL_UINT64(byteSum, summaryBytes);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_request_pages_with_cursor()
+{
+    RepoRequest query;
+    TEST_ASSERT_TRUE(query.build("octocat", nullptr));
+    TEST_ASSERT_NOT_NULL(strstr(query.body(), "\"variables\":{\"login\":\"octocat\",\"after\":null}}"));
+    TEST_ASSERT_EQUAL_size_t(strlen(query.body()), query.length());
+
+    TEST_ASSERT_TRUE(query.build("octocat", "c100"));
+    TEST_ASSERT_NOT_NULL(strstr(query.body(), "\"after\":\"c100\"}}"));
+}
+
+void test_user_without_repositories()
+{
+    ReplayServer server(nullptr, 0);
+    server.setGenerator([](const std::string &, const std::string &body) { return repoPage(0, body); });
+    TEST_ASSERT_TRUE(server.start());
+
+    RepoSummary summary;
+    const Scan scan = scanRepos(server, "octocat", summary);
+
+    TEST_ASSERT_TRUE(scan.ok);
+    TEST_ASSERT_EQUAL_UINT32(1, scan.pages);
+    assertSummary(summary, 0);
+}
+
+void test_missing_user_fails()
+{
+    ReplayServer server(nullptr, 0);
+    server.setGenerator([](const std::string &, const std::string &) {
+        return std::string("{\"data\":{\"user\":null},\"errors\":[{\"type\":\"NOT_FOUND\"}]}");
+    });
+    TEST_ASSERT_TRUE(server.start());
+
+    RepoSummary summary;
+    TEST_ASSERT_FALSE(scanRepos(server, "ghost", summary).ok);
+}
+
+void test_failed_page_fails_scan()
+{
+    ReplayOptions options;
+    options.errorPercent = 30;
+    options.seed = 7;
+
+    ReplayServer server(nullptr, 0, options);
+    server.setGenerator([](const std::string &, const std::string &body) { return repoPage(3000, body); });
+    TEST_ASSERT_TRUE(server.start());
+
+    // Partial totals would understate the stars
+    RepoSummary summary;
+    TEST_ASSERT_FALSE(scanRepos(server, "octocat", summary).ok);
+    TEST_ASSERT_TRUE(server.errors() > 0);
+}
+
+void test_scan_stops_after_max_pages()
+{
+    const uint32_t total = (RepoConfig::MaxPages + 5) * RepoConfig::PageSize;
+
+    ReplayServer server(nullptr, 0);
+    server.setGenerator([total](const std::string &, const std::string &body) { return repoPage(total, body); });
+    TEST_ASSERT_TRUE(server.start());
+
+    RepoSummary summary;
+    const Scan scan = scanRepos(server, "octocat", summary);
+
+    // The stars of the pages read would understate the total
+    TEST_ASSERT_FALSE(scan.ok);
+    TEST_ASSERT_EQUAL_UINT32(RepoConfig::MaxPages, scan.pages);
+    TEST_ASSERT_EQUAL_UINT32(RepoConfig::MaxPages, server.requests());
+}
+
+void test_thousands_of_repositories()
+{
+    const uint32_t total = 4321;
+
+    ReplayOptions options;
+    options.latencyMs = 2;
+    options.jitterMs = 3;
+
+    ReplayServer server(nullptr, 0, options);
+    server.setGenerator([total](const std::string &, const std::string &body) { return repoPage(total, body); });
+    TEST_ASSERT_TRUE(server.start());
+
+    RepoSummary summary;
+    const auto start = std::chrono::steady_clock::now();
+    const Scan scan = scanRepos(server, "octocat", summary);
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    TEST_ASSERT_TRUE(scan.ok);
+    TEST_ASSERT_EQUAL_UINT32((total + RepoConfig::PageSize - 1) / RepoConfig::PageSize, scan.pages);
+    TEST_ASSERT_EQUAL_UINT32(scan.pages, server.requests());
+    assertSummary(summary, total);
+
+    // Only the parser state is held while a page streams through
+    TEST_ASSERT_TRUE(sizeof(RepoParser) < scan.largestPage / 10);
+
+    char report[200];
+    snprintf(report, sizeof(report),
+             "%u repositories in %u pages, %zu KB, %.0f ms (%.1f ms per page), largest page %zu KB, parser %zu B, summary %zu B",
+             (unsigned)total, (unsigned)scan.pages, scan.bytes / 1024, ms, ms / scan.pages,
+             scan.largestPage / 1024, sizeof(RepoParser), sizeof(RepoSummary));
+    TEST_MESSAGE(report);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_request_pages_with_cursor);
+    RUN_TEST(test_user_without_repositories);
+    RUN_TEST(test_missing_user_fails);
+    RUN_TEST(test_failed_page_fails_scan);
+    RUN_TEST(test_scan_stops_after_max_pages);
+    RUN_TEST(test_thousands_of_repositories);
+    return UNITY_END();
+}
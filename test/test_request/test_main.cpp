@@ -0,0 +1,164 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Counts heap allocations while the GraphQL requests are built,
+ *              the request path must not touch the heap
+ */
+
+#include <unity.h>
+
+#include <new>
+#include <string>
+
+#include "GitHub/GraphQLRequest.h"
+#include "transport/HTTPTransport.h"
+
+static bool counting = false;
+static size_t allocations = 0;
+
+// The replaced operators below forward to malloc and free
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+void *operator new(size_t size)
+{
+    if (counting)
+        allocations++;
+    void *memory = malloc(size > 0 ? size : 1);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *memory) noexcept { free(memory); }
+void operator delete[](void *memory) noexcept { free(memory); }
+void operator delete(void *memory, size_t) noexcept { free(memory); }
+void operator delete[](void *memory, size_t) noexcept { free(memory); }
+
+#ifdef __GLIBC__
+// Count the C allocations as well, e.g. from snprintf or String
+extern "C" void *__libc_malloc(size_t size);
+extern "C" void *__libc_calloc(size_t count, size_t size);
+extern "C" void *__libc_realloc(void *memory, size_t size);
+
+extern "C" void *malloc(size_t size)
+{
+    if (counting)
+        allocations++;
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size)
+{
+    if (counting)
+        allocations++;
+    return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *memory, size_t size)
+{
+    if (counting)
+        allocations++;
+    return __libc_realloc(memory, size);
+}
+#endif
+
+void setUp()
+{
+    allocations = 0;
+}
+
+void tearDown()
+{
+    counting = false;
+}
+
+static tm date(const int year, const int month, const int day)
+{
+    tm result = {};
+    result.tm_year = year - 1900;
+    result.tm_mon = month - 1;
+    result.tm_mday = day;
+    return result;
+}
+
+void test_counter_sees_allocations()
+{
+    counting = true;
+    std::string *text = new std::string(64, 'x');
+    counting = false;
+    delete text;
+    TEST_ASSERT_TRUE(allocations >= 1);
+
+#ifdef __GLIBC__
+    allocations = 0;
+    counting = true;
+    void *memory = malloc(16);
+    counting = false;
+    free(memory);
+    TEST_ASSERT_EQUAL_size_t(1, allocations);
+#endif
+}
+
+void test_calendar_request_without_heap()
+{
+    const tm from = date(2025, 10, 19);
+    const tm to = date(2026, 10, 18);
+
+    counting = true;
+    CalendarRequest query;
+    query.setRange(from, to);
+    const HTTPRequest request = {"POST", "/graphql", GraphQL::Headers, 3, query.body(), query.length()};
+    counting = false;
+
+    TEST_ASSERT_EQUAL_size_t(0, allocations);
+    TEST_ASSERT_EQUAL_size_t(strlen(request.body), request.bodyLength);
+
+    const std::string expected = std::string(GraphQL::CalendarPrefix) + "2025-10-19" + GraphQL::CalendarMiddle +
+                                 "2026-10-18" + GraphQL::CalendarSuffix;
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), query.body());
+}
+
+void test_headers_are_constant()
+{
+    TEST_ASSERT_EQUAL_STRING("Authorization", GraphQL::Headers[0].key);
+    TEST_ASSERT_EQUAL_STRING("Bearer " GITHUB_PAT, GraphQL::Headers[0].value);
+    TEST_ASSERT_EQUAL_STRING("application/json", GraphQL::Headers[1].value);
+}
+
+void test_dates_are_zero_padded()
+{
+    char out[GraphQL::DateLength + 1] = {};
+    GraphQL::writeDate(out, date(987, 1, 2));
+    TEST_ASSERT_EQUAL_STRING("0987-01-02", out);
+    GraphQL::writeDate(out, date(2026, 12, 31));
+    TEST_ASSERT_EQUAL_STRING("2026-12-31", out);
+}
+
+void test_team_request_uses_arena()
+{
+    TEST_ASSERT_TRUE(Arena::wake().begin(4096));
+
+    counting = true;
+    TeamRequest query;
+    const bool built = query.build(date(2025, 10, 19), date(2026, 10, 18));
+    counting = false;
+
+    TEST_ASSERT_TRUE(built);
+    TEST_ASSERT_EQUAL_size_t(0, allocations);
+    TEST_ASSERT_EQUAL_size_t(strlen(query.body()), query.length());
+    TEST_ASSERT_NOT_NULL(strstr(query.body(), "u0: user(login: \\\"" GITHUB_USERNAME "\\\")"));
+    TEST_ASSERT_NOT_NULL(strstr(query.body(), "\"from\":\"2025-10-19T00:00:00Z\",\"to\":\"2026-10-18T23:59:59Z\"}}"));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_counter_sees_allocations);
+    RUN_TEST(test_calendar_request_without_heap);
+    RUN_TEST(test_headers_are_constant);
+    RUN_TEST(test_dates_are_zero_padded);
+    RUN_TEST(test_team_request_uses_arena);
+    return UNITY_END();
+}
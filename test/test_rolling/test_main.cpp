@@ -0,0 +1,186 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Checks the prefix sums of RollingStatistics against a brute
+ *              force sum over several years of synthetic data and measures
+ *              the time per query of both.
+ */
+
+#include <unity.h>
+
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "config/timeConfig.h"
+#include "statistics/RollingStatistics.h"
+
+static constexpr int32_t FirstDay = 18262; // 2020-01-01
+static constexpr size_t Years = 6;
+
+static std::vector<uint16_t> counts;
+
+static RangeStatistics bruteForce(int32_t from, int32_t to)
+{
+    if (from < FirstDay)
+        from = FirstDay;
+    if (to > FirstDay + (int32_t)counts.size() - 1)
+        to = FirstDay + (int32_t)counts.size() - 1;
+
+    RangeStatistics result = {};
+    for (int32_t day = from; day <= to; day++)
+    {
+        result.contributions += counts[day - FirstDay];
+        result.activeDays += counts[day - FirstDay] > 0;
+        result.days++;
+    }
+    result.average = result.days > 0 ? (float)result.contributions / result.days : 0.0f;
+    return result;
+}
+
+static RangeStatistics bruteForceWeekday(const uint8_t weekday, const int32_t from, const int32_t to)
+{
+    RangeStatistics result = {};
+    for (int32_t day = from; day <= to; day++)
+    {
+        if (day < FirstDay || day >= FirstDay + (int32_t)counts.size() || RollingStatistics::weekdayOf(day) != weekday)
+            continue;
+        result.contributions += counts[day - FirstDay];
+        result.activeDays += counts[day - FirstDay] > 0;
+        result.days++;
+    }
+    return result;
+}
+
+static void assertEqual(const RangeStatistics &expected, const RangeStatistics &actual)
+{
+    TEST_ASSERT_EQUAL_UINT32(expected.contributions, actual.contributions);
+    TEST_ASSERT_EQUAL_UINT16(expected.activeDays, actual.activeDays);
+    TEST_ASSERT_EQUAL_UINT16(expected.days, actual.days);
+}
+
+void setUp()
+{
+    Arena::wake().reset();
+}
+
+void tearDown() {}
+
+void test_random_ranges_match_brute_force()
+{
+    RollingStatistics rolling;
+    TEST_ASSERT_TRUE(rolling.build(FirstDay, counts.data(), counts.size()));
+
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int32_t> day(FirstDay - 30, FirstDay + (int32_t)counts.size() + 30);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        int32_t from = day(random);
+        int32_t to = day(random);
+        if (from > to)
+            std::swap(from, to);
+
+        assertEqual(bruteForce(from, to), rolling.range(from, to));
+        const uint8_t weekday = i % 7;
+        assertEqual(bruteForceWeekday(weekday, from, to), rolling.weekday(weekday, from, to));
+    }
+}
+
+void test_months_and_weeks()
+{
+    RollingStatistics rolling;
+    TEST_ASSERT_TRUE(rolling.build(FirstDay, counts.data(), counts.size()));
+
+    for (size_t year = 0; year < Years; year++)
+    {
+        for (int month = 1; month <= 12; month++)
+        {
+            const int32_t first = TimeUtils::daysFromCivil(2020 + year, month, 1);
+            const int32_t next = month == 12 ? TimeUtils::daysFromCivil(2021 + year, 1, 1)
+                                             : TimeUtils::daysFromCivil(2020 + year, month + 1, 1);
+            assertEqual(bruteForce(first, next - 1), rolling.month(2020 + year, month));
+        }
+    }
+
+    const int32_t today = FirstDay + 1000;
+    const int32_t sunday = today - RollingStatistics::weekdayOf(today);
+    assertEqual(bruteForce(sunday, sunday + 6), rolling.week(today, 0));
+    assertEqual(bruteForce(sunday - 7, sunday - 1), rolling.week(today, 1));
+    assertEqual(bruteForce(today - 89, today), rolling.lastDays(90, today));
+}
+
+void test_fetched_calendar_includes_today()
+{
+    // The fetched range ends with today on every weekday, nothing is clamped away
+    for (int32_t today = FirstDay + 800; today < FirstDay + 807; today++)
+    {
+        Arena::wake().reset();
+
+        GitHubStats stats = {};
+        stats.startDay = TimeUtils::calendarStart(today, TimeConfig::CalendarWeeks);
+        for (int32_t day = stats.startDay; day <= today; day++)
+            stats.commits[day - stats.startDay] = counts[day - FirstDay];
+
+        RollingStatistics rolling;
+        TEST_ASSERT_TRUE(rolling.build(stats, today));
+        assertEqual(bruteForce(today, today), rolling.range(today, today));
+        assertEqual(bruteForce(today - 6, today), rolling.lastDays(7, today));
+        assertEqual(bruteForce(stats.startDay, today), rolling.lastDays(today - stats.startDay + 1, today));
+    }
+}
+
+void test_benchmark()
+{
+    RollingStatistics rolling;
+    TEST_ASSERT_TRUE(rolling.build(FirstDay, counts.data(), counts.size()));
+
+    std::mt19937 random(11);
+    std::uniform_int_distribution<int32_t> day(FirstDay, FirstDay + (int32_t)counts.size() - 1);
+    std::vector<std::pair<int32_t, int32_t>> ranges(5000);
+    for (auto &range : ranges)
+    {
+        range = {day(random), day(random)};
+        if (range.first > range.second)
+            std::swap(range.first, range.second);
+    }
+
+    using Clock = std::chrono::steady_clock;
+    uint64_t checksum = 0;
+
+    const auto prefixStart = Clock::now();
+    for (int repeat = 0; repeat < 20; repeat++)
+        for (const auto &range : ranges)
+            checksum += rolling.range(range.first, range.second).contributions;
+    const double prefixNs = std::chrono::duration<double, std::nano>(Clock::now() - prefixStart).count() / (20 * ranges.size());
+
+    const auto bruteStart = Clock::now();
+    for (const auto &range : ranges)
+        checksum -= 20 * (uint64_t)bruteForce(range.first, range.second).contributions;
+    const double bruteNs = std::chrono::duration<double, std::nano>(Clock::now() - bruteStart).count() / ranges.size();
+
+    printf("test_benchmark:INFO: %zu days, prefix sums %.1f ns per range, brute force %.1f ns per range\n",
+           counts.size(), prefixNs, bruteNs);
+    TEST_ASSERT_EQUAL_UINT64(0, checksum);
+    TEST_ASSERT_TRUE(prefixNs < bruteNs);
+}
+
+int main()
+{
+    // Several years of activity with quiet weeks in between
+    std::mt19937 random(2026);
+    std::uniform_int_distribution<int> percent(0, 99);
+    counts.resize(TimeUtils::daysFromCivil(2020 + Years, 1, 1) - FirstDay);
+    for (size_t i = 0; i < counts.size(); i++)
+        counts[i] = (i / 7) % 5 == 4 || percent(random) < 30 ? 0 : percent(random) % 25 + 1;
+
+    Arena::wake().begin(64 * 1024);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_random_ranges_match_brute_force);
+    RUN_TEST(test_months_and_weeks);
+    RUN_TEST(test_fetched_calendar_includes_today);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
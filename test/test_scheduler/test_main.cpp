@@ -0,0 +1,193 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Walks the SleepScheduler through a simulated year of local
+ *              time including both DST changes, and checks that stretched
+ *              sleeps never run past the wake after midnight.
+ */
+
+#include <unity.h>
+
+#include "time/SleepScheduler.h"
+
+static time_t local(const int year, const int month, const int day, const int hour, const int minute,
+                    const int second = 0)
+{
+    tm date = {};
+    date.tm_year = year - 1900;
+    date.tm_mon = month - 1;
+    date.tm_mday = day;
+    date.tm_hour = hour;
+    date.tm_min = minute;
+    date.tm_sec = second;
+    date.tm_isdst = -1;
+    return mktime(&date);
+}
+
+static tm split(const time_t epoch)
+{
+    tm result;
+    localtime_r(&epoch, &result);
+    return result;
+}
+
+// Wake just after the local midnight that follows now
+static time_t nextMidnight(const time_t now)
+{
+    const tm today = split(now);
+    return local(today.tm_year + 1900, today.tm_mon + 1, today.tm_mday + 1, 0, 0, TimeConfig::MidnightDelay);
+}
+
+void setUp()
+{
+    SleepScheduler::recordCalendar(true);
+}
+
+void tearDown() {}
+
+void test_unset_clock_uses_fallback()
+{
+    SleepScheduler scheduler;
+    TEST_ASSERT_EQUAL_INT64(0, scheduler.nextWake(1000));
+    TEST_ASSERT_EQUAL_UINT64(TimeConfig::SleepTime, scheduler.sleepDurationUs(TimeConfig::MinValidTime - 1));
+    TEST_ASSERT_EQUAL_UINT64(12345, scheduler.limitToMidnight(12345));
+}
+
+void test_simulated_year()
+{
+    SleepScheduler scheduler;
+    const time_t end = local(2027, 1, 1, 0, 0);
+    uint32_t wakes = 0;
+
+    // 7 minute steps hit every minute of the hour over the year
+    for (time_t now = local(2026, 1, 1, 0, 0); now < end; now += 7 * 60 + 13)
+    {
+        const time_t wake = scheduler.nextWake(now);
+        const time_t midnight = nextMidnight(now);
+        const tm at = split(wake);
+        const tm current = split(now);
+
+        TEST_ASSERT_TRUE(wake > now);
+        TEST_ASSERT_TRUE(wake <= midnight);
+
+        if (wake == midnight)
+        {
+            TEST_ASSERT_EQUAL_INT(0, at.tm_hour);
+            TEST_ASSERT_EQUAL_INT(TimeConfig::MidnightDelay, at.tm_min * 60 + at.tm_sec);
+            continue;
+        }
+
+        // Every other wake is on a full local hour and leaves the minimum sleep
+        TEST_ASSERT_EQUAL_INT(0, at.tm_min);
+        TEST_ASSERT_EQUAL_INT(0, at.tm_sec);
+        TEST_ASSERT_TRUE(wake - now >= (time_t)TimeConfig::MinSleep);
+
+        // Overnight the next wake is the end of the night, unless that is too close
+        const time_t nightEnd = local(current.tm_year + 1900, current.tm_mon + 1, current.tm_mday,
+                                      TimeConfig::NightEndHour, 0);
+        if (current.tm_hour < TimeConfig::NightEndHour && nightEnd - now >= (time_t)TimeConfig::MinSleep)
+            TEST_ASSERT_EQUAL_INT64(nightEnd, wake);
+        else
+            TEST_ASSERT_TRUE(wake - now <= (time_t)(TimeConfig::WakeInterval + TimeConfig::MinSleep));
+
+        wakes++;
+    }
+
+    TEST_ASSERT_TRUE(wakes > 60000);
+}
+
+void test_spring_forward()
+{
+    SleepScheduler scheduler;
+
+    // The night of 2026-03-29 is an hour shorter
+    const time_t midnight = local(2026, 3, 29, 0, 1);
+    TEST_ASSERT_EQUAL_INT64(midnight, scheduler.nextWake(local(2026, 3, 28, 23, 20)));
+    TEST_ASSERT_EQUAL_INT64(midnight + (7 * 3600 - 60) - 3600, scheduler.nextWake(midnight));
+    TEST_ASSERT_EQUAL_INT(7, split(scheduler.nextWake(midnight)).tm_hour);
+
+    // Hours stay aligned after the switch
+    const time_t wake = scheduler.nextWake(local(2026, 3, 29, 9, 40));
+    TEST_ASSERT_EQUAL_INT(10, split(wake).tm_hour);
+    TEST_ASSERT_EQUAL_INT(0, split(wake).tm_min);
+}
+
+void test_fall_back()
+{
+    SleepScheduler scheduler;
+
+    // The night of 2026-10-25 is an hour longer
+    const time_t midnight = local(2026, 10, 25, 0, 1);
+    TEST_ASSERT_EQUAL_INT64(midnight, scheduler.nextWake(local(2026, 10, 24, 23, 5)));
+    TEST_ASSERT_EQUAL_INT64(midnight + (7 * 3600 - 60) + 3600, scheduler.nextWake(midnight));
+
+    // The second pass of 02:30 still wakes at 07:00 standard time
+    const time_t repeated = local(2026, 10, 25, 1, 30) + 2 * 3600;
+    TEST_ASSERT_EQUAL_INT(2, split(repeated).tm_hour);
+    TEST_ASSERT_EQUAL_INT(0, split(repeated).tm_isdst);
+    TEST_ASSERT_EQUAL_INT64(repeated + 4 * 3600 + 30 * 60, scheduler.nextWake(repeated));
+}
+
+void test_stretched_sleep_stops_at_midnight()
+{
+    SleepScheduler scheduler;
+
+    // A short stretch in the evening is kept
+    const time_t evening = local(2026, 6, 10, 20, 10);
+    const uint64_t scheduled = scheduler.sleepDurationUs(evening);
+    TEST_ASSERT_EQUAL_UINT64(50ULL * 60 * 1000000, scheduled);
+    TEST_ASSERT_EQUAL_UINT64(scheduled * 4, scheduler.limitToMidnight(scheduled * 4));
+
+    // A longer one ends at the wake after midnight
+    const uint64_t untilMidnight = (uint64_t)(local(2026, 6, 11, 0, 1) - evening) * 1000000ULL;
+    TEST_ASSERT_EQUAL_UINT64(untilMidnight, scheduler.limitToMidnight(scheduled * 8));
+
+    // The night wake is not cut short, only the stretch is capped
+    const time_t night = local(2026, 6, 11, 0, 1);
+    const uint64_t sleep = scheduler.sleepDurationUs(night);
+    TEST_ASSERT_EQUAL_UINT64(sleep, scheduler.limitToMidnight(sleep));
+    TEST_ASSERT_EQUAL_UINT64(24ULL * 3600 * 1000000, scheduler.limitToMidnight(sleep * 8));
+}
+
+void test_stretch_across_spring_forward()
+{
+    SleepScheduler scheduler;
+
+    const time_t evening = local(2026, 3, 28, 21, 10);
+    scheduler.sleepDurationUs(evening);
+    const uint64_t limited = scheduler.limitToMidnight(12ULL * 3600 * 1000000);
+    TEST_ASSERT_EQUAL_INT64(local(2026, 3, 29, 0, 1), evening + (time_t)(limited / 1000000ULL));
+
+    // From the midnight wake the cap is the next midnight, 23 hours later
+    const time_t midnight = local(2026, 3, 29, 0, 1);
+    scheduler.sleepDurationUs(midnight);
+    TEST_ASSERT_EQUAL_UINT64(23ULL * 3600 * 1000000, scheduler.limitToMidnight(48ULL * 3600 * 1000000));
+}
+
+void test_idle_interval_is_aligned()
+{
+    SleepScheduler scheduler;
+    for (uint8_t i = 0; i < TimeConfig::IdleAfterWakes; i++)
+        SleepScheduler::recordCalendar(false);
+
+    const time_t now = local(2026, 7, 1, 10, 30);
+    const time_t wake = scheduler.nextWake(now);
+    TEST_ASSERT_EQUAL_INT64(local(2026, 7, 1, 13, 0), wake);
+}
+
+int main()
+{
+    setenv("TZ", TimeConfig::Timezone, 1);
+    tzset();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_unset_clock_uses_fallback);
+    RUN_TEST(test_simulated_year);
+    RUN_TEST(test_spring_forward);
+    RUN_TEST(test_fall_back);
+    RUN_TEST(test_stretched_sleep_stops_at_midnight);
+    RUN_TEST(test_stretch_across_spring_forward);
+    RUN_TEST(test_idle_interval_is_aligned);
+    return UNITY_END();
+}
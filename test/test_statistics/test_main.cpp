@@ -0,0 +1,192 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Compares the incremental StatisticsEngine with a brute force
+ *              evaluation over random contribution histories, fetched the
+ *              way TimeManager::capture sizes the calendar range.
+ */
+
+#include <unity.h>
+
+#include <random>
+#include <vector>
+
+#include "config/timeConfig.h"
+#include "statistics/StatisticsEngine.h"
+#include "time/timeUtils.h"
+
+static constexpr int32_t Window = sizeof(GitHubStats::commits) / sizeof(GitHubStats::commits[0]);
+
+struct Expected
+{
+    uint32_t current;
+    uint32_t longest;
+    uint16_t max;
+};
+
+// Full contribution history, indexed by day since 1970-01-01 minus origin
+struct History
+{
+    int32_t origin;
+    std::vector<uint16_t> counts;
+
+    uint16_t at(const int32_t day) const
+    {
+        const int32_t index = day - origin;
+        return index >= 0 && index < (int32_t)counts.size() ? counts[index] : 0;
+    }
+};
+
+static GitHubStats fetch(const History &history, const int32_t today)
+{
+    GitHubStats stats = {};
+    stats.startDay = TimeUtils::calendarStart(today, TimeConfig::CalendarWeeks);
+    stats.firstDay = stats.startDay;
+
+    for (int32_t day = stats.startDay; day <= today; day++)
+    {
+        stats.commits[day - stats.startDay] = history.at(day);
+        stats.contributions += history.at(day);
+    }
+
+    return stats;
+}
+
+/**
+ * Statistics from all days
+ * @param since First day a streak may reach back to
+ * @param start First day of the window
+ */
+static Expected bruteForce(const History &history, const int32_t since, const int32_t start, const int32_t today)
+{
+    Expected expected = {};
+
+    uint32_t streak = 0;
+    for (int32_t day = today - 1; day >= since && history.at(day) > 0; day--)
+        streak++;
+    expected.current = history.at(today) > 0 ? streak + 1 : 0;
+
+    uint32_t run = 0;
+    for (int32_t day = start; day <= today; day++)
+    {
+        const uint16_t count = history.at(day);
+        run = count > 0 ? run + 1 : 0;
+        if (run > expected.longest)
+            expected.longest = run;
+        if (count > expected.max)
+            expected.max = count;
+    }
+
+    if (expected.current > expected.longest)
+        expected.longest = expected.current;
+
+    return expected;
+}
+
+static History randomHistory(std::mt19937 &random, const int32_t origin, const size_t days)
+{
+    History history = {origin, std::vector<uint16_t>(days)};
+
+    // Alternate busy and quiet stretches so that long streaks occur
+    std::uniform_int_distribution<int> stretch(1, 40);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::uniform_int_distribution<int> count(1, 30);
+
+    size_t day = 0;
+    while (day < days)
+    {
+        const int activity = percent(random);
+        const size_t end = std::min(days, day + stretch(random));
+        for (; day < end; day++)
+            history.counts[day] = percent(random) < activity ? count(random) : 0;
+    }
+
+    return history;
+}
+
+void setUp()
+{
+    StatisticsEngine::reset();
+}
+
+void tearDown() {}
+
+void test_range_fits_window_on_every_weekday()
+{
+    for (int32_t today = 20000; today < 20000 + 14; today++)
+    {
+        const int32_t start = TimeUtils::calendarStart(today, TimeConfig::CalendarWeeks);
+        TEST_ASSERT_EQUAL_INT(0, TimeUtils::weekdayFromDays(start));
+        TEST_ASSERT_TRUE(today - start < Window);
+        TEST_ASSERT_TRUE(today - start >= 7 * TimeConfig::CalendarWeeks);
+    }
+}
+
+void test_random_histories_match_brute_force()
+{
+    std::mt19937 random(20261018);
+    std::uniform_int_distribution<int> percent(0, 99);
+    uint32_t wakes = 0;
+    uint32_t corrections = 0;
+
+    for (int round = 0; round < 25; round++)
+    {
+        StatisticsEngine::reset();
+
+        const int32_t origin = 19000 + percent(random) * 3;
+        History history = randomHistory(random, origin, 1400);
+
+        int32_t today = origin + 400 + percent(random) % 7;
+        const int32_t since = TimeUtils::calendarStart(today, TimeConfig::CalendarWeeks);
+        GitHubStats previous = {};
+
+        while (today < origin + 1300)
+        {
+            // Contributions of a finished day may still change, e.g. a late push
+            if (percent(random) < 5)
+            {
+                const int32_t day = today - 1 - percent(random) * 3;
+                if (day >= TimeUtils::calendarStart(today, TimeConfig::CalendarWeeks))
+                {
+                    history.counts[day - origin] = history.at(day) > 0 ? 0 : 7;
+                    corrections++;
+                }
+            }
+
+            GitHubStats fetched = fetch(history, today);
+            StatisticsEngine::update(previous, fetched, today);
+
+            const Expected expected = bruteForce(history, since, fetched.startDay, today);
+            TEST_ASSERT_EQUAL_UINT32(expected.current, StatisticsEngine::currentStreak());
+            TEST_ASSERT_EQUAL_UINT32(expected.longest, StatisticsEngine::longestStreak());
+            TEST_ASSERT_EQUAL_UINT16(expected.max, StatisticsEngine::maxContributions());
+
+            // Calendars without incremental state only know their own days
+            GitHubStats evaluated = fetched;
+            StatisticsEngine::evaluate(evaluated, today, TimeUtils::weekdayFromDays(today));
+            const Expected window = bruteForce(history, fetched.startDay, fetched.startDay, today);
+            TEST_ASSERT_EQUAL_INT(window.current, evaluated.currentStreak);
+            TEST_ASSERT_EQUAL_INT(window.longest, evaluated.longestStreak);
+            TEST_ASSERT_EQUAL_INT(window.max, evaluated.maxContributions);
+
+            previous = fetched;
+            wakes++;
+
+            // Several wakes a day, then one or more days later
+            const int step = percent(random);
+            today += step < 40 ? 0 : step < 85 ? 1 : step < 97 ? 2 + step % 3 : 10 + step % 20;
+        }
+    }
+
+    TEST_ASSERT_TRUE(wakes > 10000);
+    TEST_ASSERT_TRUE(corrections > 100);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_range_fits_window_on_every_weekday);
+    RUN_TEST(test_random_histories_match_brute_force);
+    return UNITY_END();
+}
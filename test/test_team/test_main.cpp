@@ -0,0 +1,211 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Checks TeamAggregate against a plain sum over hundreds of
+ *              synthetic members and builds the aggregate of the stored team
+ */
+
+#include <unity.h>
+
+#include <random>
+#include <vector>
+
+#include "team/TeamAggregate.h"
+
+static constexpr int32_t Today = 20744; // 2026-10-18, a Sunday
+static constexpr uint16_t Members = 500;
+
+static std::mt19937 generator(49);
+
+void setUp()
+{
+    Arena::wake().reset();
+}
+
+void tearDown() {}
+
+/**
+ * Calendar with a contribution on most days, on every day of the last three
+ * weeks and a few very busy days that saturate the sums
+ */
+static TeamMember synthetic(const int32_t startDay, const int32_t today)
+{
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    TeamMember member = {};
+    member.valid = true;
+    member.profile.followers = percent(generator);
+    member.stats.startDay = startDay;
+    member.stats.firstDay = startDay;
+
+    for (int32_t day = startDay; day <= today && day - startDay < TeamAggregate::Days; day++)
+    {
+        const int roll = percent(generator);
+        uint16_t count = roll < 25 && today - day > 20 ? 0 : roll % 12 + 1;
+        if (roll == 99)
+            count = 30000;
+        member.stats.commits[day - startDay] = count;
+        member.stats.contributions += count;
+    }
+
+    return member;
+}
+
+void test_word_adds_match_scalar()
+{
+    std::uniform_int_distribution<uint32_t> value(0, UINT16_MAX);
+
+    for (size_t days = 0; days < 40; days++)
+    {
+        std::vector<uint16_t> sums(days), counts(days), expectedSums(days);
+        std::vector<uint16_t> active(days), expectedActive(days);
+        for (size_t i = 0; i < days; i++)
+        {
+            // Mix small values, zeros and values close to the top bit
+            sums[i] = expectedSums[i] = i % 3 == 0 ? value(generator) : value(generator) % 8;
+            counts[i] = i % 4 == 0 ? 0 : value(generator);
+            active[i] = expectedActive[i] = value(generator) % 1000;
+
+            const uint32_t sum = (uint32_t)expectedSums[i] + counts[i];
+            expectedSums[i] = sum > UINT16_MAX ? UINT16_MAX : sum;
+            expectedActive[i] += counts[i] > 0;
+        }
+
+        TeamAggregate::saturatingAdd(sums.data(), counts.data(), days);
+        TeamAggregate::countActive(active.data(), counts.data(), days);
+
+        for (size_t i = 0; i < days; i++)
+        {
+            TEST_ASSERT_EQUAL_UINT16(expectedSums[i], sums[i]);
+            TEST_ASSERT_EQUAL_UINT16(expectedActive[i], active[i]);
+        }
+    }
+}
+
+void test_hundreds_of_members()
+{
+    const int32_t startDay = TimeUtils::calendarStart(Today, TimeConfig::CalendarWeeks);
+    const uint8_t weekday = TimeUtils::weekdayFromDays(Today);
+
+    std::vector<uint32_t> sums(TeamAggregate::Days, 0);
+    std::vector<uint16_t> active(TeamAggregate::Days, 0), top(TeamAggregate::Days, TeamAggregate::NoContributor);
+    std::vector<uint16_t> topCount(TeamAggregate::Days, 0);
+    uint32_t followers = 0;
+    uint16_t valid = 0;
+
+    TeamAggregate *aggregate = Arena::wake().create<TeamAggregate>();
+    TEST_ASSERT_NOT_NULL(aggregate);
+    aggregate->begin(startDay);
+
+    for (uint16_t index = 0; index < Members; index++)
+    {
+        // Some calendars were fetched a week or two earlier, some never arrived
+        const int32_t shift = index % 10 == 0 ? -7 : index % 25 == 0 ? -14 : 0;
+        TeamMember member = synthetic(startDay + shift, Today + shift);
+        member.valid = index % 50 != 7;
+        aggregate->add(member, index);
+
+        if (!member.valid)
+            continue;
+
+        valid++;
+        followers += member.profile.followers;
+        for (int32_t day = startDay; day <= Today; day++)
+        {
+            const int32_t i = day - member.stats.startDay;
+            const uint16_t count = i < TeamAggregate::Days ? member.stats.commits[i] : 0;
+            sums[day - startDay] += count;
+            active[day - startDay] += count > 0;
+            if (count > topCount[day - startDay])
+            {
+                topCount[day - startDay] = count;
+                top[day - startDay] = index;
+            }
+        }
+    }
+
+    aggregate->finish(Today, weekday);
+
+    TEST_ASSERT_EQUAL_UINT16(valid, aggregate->members());
+    TEST_ASSERT_EQUAL_UINT32(followers, aggregate->profile().followers);
+    TEST_ASSERT_EQUAL_INT32(startDay, aggregate->stats().startDay);
+
+    uint32_t streak = 0, longest = 0, everyone = 0, everyoneLongest = 0;
+    for (int32_t day = startDay; day <= Today; day++)
+    {
+        const int32_t i = day - startDay;
+        TEST_ASSERT_EQUAL_UINT16(sums[i] > UINT16_MAX ? UINT16_MAX : sums[i], aggregate->stats().commits[i]);
+        TEST_ASSERT_EQUAL_UINT16(active[i], aggregate->activeMembers(day));
+        TEST_ASSERT_EQUAL_UINT16(top[i], aggregate->topContributor(day));
+
+        streak = sums[i] > 0 ? streak + 1 : 0;
+        longest = streak > longest ? streak : longest;
+        everyone = active[i] == valid ? everyone + 1 : 0;
+        everyoneLongest = everyone > everyoneLongest ? everyone : everyoneLongest;
+    }
+
+    TEST_ASSERT_EQUAL_INT(streak, aggregate->stats().currentStreak);
+    TEST_ASSERT_EQUAL_INT(longest, aggregate->stats().longestStreak);
+    TEST_ASSERT_EQUAL_UINT32(everyone, aggregate->everyoneStreak());
+    TEST_ASSERT_EQUAL_UINT32(everyoneLongest, aggregate->everyoneLongest());
+
+    // The calendars fetched earlier end before today, all members were active
+    // only on the days their active weeks overlap
+    TEST_ASSERT_EQUAL_UINT32(0, aggregate->everyoneStreak());
+    TEST_ASSERT_TRUE(aggregate->everyoneLongest() >= 7);
+}
+
+void test_build_uses_the_stored_window()
+{
+    // On every day of a week the stored calendars end with today
+    for (int32_t today = Today; today < Today + 7; today++)
+    {
+        Arena::wake().reset();
+        const int32_t startDay = TimeUtils::calendarStart(today, TimeConfig::CalendarWeeks);
+
+        TeamMember members[TeamConfig::UserCount];
+        uint32_t todayCount = 0;
+        for (uint8_t i = 0; i < TeamConfig::UserCount; i++)
+        {
+            members[i] = synthetic(startDay, today);
+            members[i].stats.commits[today - startDay] = i + 1;
+            todayCount += i + 1;
+        }
+        TEST_ASSERT_TRUE(TeamStore::store(members, TeamConfig::UserCount));
+
+        TeamAggregate *aggregate = Arena::wake().create<TeamAggregate>();
+        TEST_ASSERT_NOT_NULL(aggregate);
+        TEST_ASSERT_TRUE(aggregate->build(today, TimeUtils::weekdayFromDays(today)));
+
+        TEST_ASSERT_EQUAL_INT32(startDay, aggregate->stats().startDay);
+        TEST_ASSERT_EQUAL_UINT16(todayCount, aggregate->stats().commits[today - startDay]);
+        TEST_ASSERT_EQUAL_UINT16(TeamConfig::UserCount, aggregate->activeMembers(today));
+        TEST_ASSERT_EQUAL_UINT16(TeamConfig::UserCount - 1, aggregate->topContributor(today));
+        TEST_ASSERT_TRUE(aggregate->stats().currentStreak >= 21);
+        TEST_ASSERT_TRUE(aggregate->everyoneStreak() >= 21);
+    }
+}
+
+void test_build_without_members()
+{
+    LittleFSFS::erase();
+
+    TeamAggregate *aggregate = Arena::wake().create<TeamAggregate>();
+    TEST_ASSERT_NOT_NULL(aggregate);
+    TEST_ASSERT_FALSE(aggregate->build(Today, TimeUtils::weekdayFromDays(Today)));
+    TEST_ASSERT_EQUAL_UINT16(0, aggregate->members());
+    TEST_ASSERT_EQUAL_INT32(TimeUtils::calendarStart(Today, TimeConfig::CalendarWeeks), aggregate->stats().startDay);
+}
+
+int main()
+{
+    Arena::wake().begin(32 * 1024);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_word_adds_match_scalar);
+    RUN_TEST(test_hundreds_of_members);
+    RUN_TEST(test_build_uses_the_stored_window);
+    RUN_TEST(test_build_without_members);
+    return UNITY_END();
+}
@@ -0,0 +1,32 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Responses recorded from the GitHub API, shortened to the fields
+ *              the display uses
+ */
+
+#pragma once
+
+#include "ReplayServer.h"
+
+static const char ProfileBody[] =
+    "{\"login\":\"octocat\",\"id\":583231,\"type\":\"User\",\"name\":\"The Octocat\",\"company\":\"@github\","
+    "\"blog\":\"https://github.blog\",\"location\":\"San Francisco\",\"email\":null,\"bio\":null,"
+    "\"twitter_username\":null,\"public_repos\":8,\"public_gists\":8,\"followers\":21712,\"following\":9,"
+    "\"created_at\":\"2011-01-25T18:44:36Z\",\"updated_at\":\"2026-09-22T11:25:21Z\"}";
+
+static const char CalendarBody[] =
+    "{\"data\":{\"user\":{\"contributionsCollection\":{\"contributionCalendar\":{\"totalContributions\":3,"
+    "\"weeks\":[{\"contributionDays\":[{\"date\":\"2026-10-11\",\"contributionCount\":0},"
+    "{\"date\":\"2026-10-12\",\"contributionCount\":1},{\"date\":\"2026-10-13\",\"contributionCount\":2}]}]}}},"
+    "\"rateLimit\":{\"cost\":1,\"remaining\":4999,\"resetAt\":\"2026-10-18T10:00:00Z\"}}}";
+
+static const Recording GitHubRecordings[] = {
+    {"GET", "/users/octocat", 200,
+     "X-RateLimit-Limit: 5000\r\nX-RateLimit-Remaining: 4987\r\nX-RateLimit-Reset: 1792314000\r\nX-RateLimit-Resource: core\r\n",
+     ProfileBody},
+    {"POST", "/graphql", 200,
+     "X-RateLimit-Limit: 5000\r\nX-RateLimit-Remaining: 4999\r\nX-RateLimit-Resource: graphql\r\n",
+     CalendarBody},
+    {"GET", "/users/ghost", 404, "", "{\"message\":\"Not Found\"}"}};
@@ -0,0 +1,230 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Runs the POSIX transport against the replay server and reports
+ *              the latency distribution of the requests, streams the bodies
+ *              through the JSON tokenizer
+ */
+
+#include <unity.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "GitHub/JsonStream.h"
+#include "ReplayServer.h"
+#include "recordings.h"
+#include "transport/PosixTransport.h"
+
+static const HTTPHeader JsonHeaders[] = {{"Content-Type", "application/json"}};
+
+void setUp() {}
+void tearDown() {}
+
+static std::string readBody(PosixTransport &transport)
+{
+    std::string body;
+    char chunk[128];
+    size_t length;
+    while ((length = transport.readBytes(chunk, sizeof(chunk))) > 0)
+        body.append(chunk, length);
+    return body;
+}
+
+static uint32_t percentile(std::vector<uint32_t> values, const uint8_t percent)
+{
+    std::sort(values.begin(), values.end());
+    return values[(values.size() - 1) * percent / 100];
+}
+
+void test_profile_is_replayed()
+{
+    ReplayServer server(GitHubRecordings, 3);
+    TEST_ASSERT_TRUE(server.start());
+
+    const std::string url = server.url("/users/octocat");
+    const HTTPRequest request = {"GET", url.c_str(), nullptr, 0, nullptr, 0};
+
+    PosixTransport transport;
+    TEST_ASSERT_EQUAL_INT(200, transport.begin(request));
+    TEST_ASSERT_EQUAL_INT(strlen(ProfileBody), transport.contentLength());
+    TEST_ASSERT_EQUAL_STRING("4987", transport.header("X-RateLimit-Remaining"));
+    TEST_ASSERT_EQUAL_STRING("core", transport.header("X-RateLimit-Resource"));
+    TEST_ASSERT_EQUAL_STRING("Sun, 18 Oct 2026 09:00:00 GMT", transport.header("Date"));
+    TEST_ASSERT_NULL(transport.header("Content-Encoding"));
+    TEST_ASSERT_EQUAL_STRING(ProfileBody, readBody(transport).c_str());
+    transport.end();
+
+    TEST_ASSERT_EQUAL_UINT32(strlen(ProfileBody), transport.timing().bytesReceived);
+}
+
+void test_graphql_body_reaches_server()
+{
+    ReplayServer server(GitHubRecordings, 3);
+    TEST_ASSERT_TRUE(server.start());
+
+    const char query[] = "{\"query\":\"query { rateLimit { cost } }\"}";
+    const std::string url = server.url("/graphql");
+    const HTTPRequest request = {"POST", url.c_str(), JsonHeaders, 1, query, strlen(query)};
+
+    PosixTransport transport;
+    TEST_ASSERT_EQUAL_INT(200, transport.begin(request));
+    TEST_ASSERT_EQUAL_STRING(CalendarBody, readBody(transport).c_str());
+    TEST_ASSERT_EQUAL_STRING(query, server.lastRequestBody().c_str());
+}
+
+void test_missing_user_is_not_found()
+{
+    ReplayServer server(GitHubRecordings, 3);
+    TEST_ASSERT_TRUE(server.start());
+
+    const std::string url = server.url("/users/ghost");
+    const HTTPRequest request = {"GET", url.c_str(), nullptr, 0, nullptr, 0};
+
+    PosixTransport transport;
+    TEST_ASSERT_EQUAL_INT(404, transport.begin(request));
+}
+
+void test_unreachable_server_fails()
+{
+    uint16_t port;
+    {
+        ReplayServer server(GitHubRecordings, 3);
+        TEST_ASSERT_TRUE(server.start());
+        port = strtoul(server.url("").c_str() + strlen("http://127.0.0.1:"), nullptr, 10);
+    }
+
+    const std::string url = "http://127.0.0.1:" + std::to_string(port) + "/users/octocat";
+    const HTTPRequest request = {"GET", url.c_str(), nullptr, 0, nullptr, 0};
+
+    PosixTransport transport;
+    TEST_ASSERT_TRUE(transport.begin(request) <= 0);
+}
+
+void test_injected_faults()
+{
+    ReplayOptions errors;
+    errors.errorPercent = 100;
+    ReplayServer failing(GitHubRecordings, 3, errors);
+    TEST_ASSERT_TRUE(failing.start());
+
+    std::string url = failing.url("/users/octocat");
+    HTTPRequest request = {"GET", url.c_str(), nullptr, 0, nullptr, 0};
+
+    PosixTransport transport;
+    TEST_ASSERT_EQUAL_INT(502, transport.begin(request));
+    transport.end();
+
+    // A cut off body ends early instead of blocking until the timeout
+    ReplayOptions drops;
+    drops.dropPercent = 100;
+    ReplayServer dropping(GitHubRecordings, 3, drops);
+    TEST_ASSERT_TRUE(dropping.start());
+
+    url = dropping.url("/users/octocat");
+    request.url = url.c_str();
+
+    TEST_ASSERT_EQUAL_INT(200, transport.begin(request));
+    const std::string body = readBody(transport);
+    TEST_ASSERT_TRUE(body.size() < (size_t)transport.contentLength());
+    TEST_ASSERT_EQUAL_UINT32(1, dropping.drops());
+}
+
+void test_latency_distribution()
+{
+    ReplayOptions options;
+    options.latencyMs = 5;
+    options.jitterMs = 20;
+    options.bytesPerSecond = 20000;
+    options.errorPercent = 10;
+    options.seed = 42;
+
+    ReplayServer server(GitHubRecordings, 3, options);
+    TEST_ASSERT_TRUE(server.start());
+
+    const std::string url = server.url("/graphql");
+    const char query[] = "{\"query\":\"query { rateLimit { cost } }\"}";
+    const HTTPRequest request = {"POST", url.c_str(), JsonHeaders, 1, query, strlen(query)};
+
+    std::vector<uint32_t> headers, totals;
+    uint32_t failed = 0;
+
+    for (int i = 0; i < 60; i++)
+    {
+        PosixTransport transport;
+        const int status = transport.begin(request);
+        if (status != 200)
+        {
+            failed++;
+            continue;
+        }
+
+        TEST_ASSERT_EQUAL_STRING(CalendarBody, readBody(transport).c_str());
+        transport.end();
+        headers.push_back(transport.timing().headersMs);
+        totals.push_back(transport.timing().totalMs);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(server.errors(), failed);
+    TEST_ASSERT_FALSE(headers.empty());
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(options.latencyMs, percentile(headers, 0));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(options.latencyMs + options.jitterMs + 50, percentile(headers, 50));
+
+    char report[160];
+    snprintf(report, sizeof(report), "headers p50 %u p90 %u p99 %u ms, total p50 %u p90 %u p99 %u ms, %u of 60 failed",
+             percentile(headers, 50), percentile(headers, 90), percentile(headers, 99),
+             percentile(totals, 50), percentile(totals, 90), percentile(totals, 99), failed);
+    TEST_MESSAGE(report);
+}
+
+// Records the container key of every name in the order they arrive
+class NameStream : public JsonStream
+{
+public:
+    std::vector<std::string> names, parents;
+
+protected:
+    void value(const bool text) override
+    {
+        if (!text || !isKey("name"))
+            return;
+        names.push_back(token());
+        parents.push_back(parent());
+    }
+};
+
+void test_stream_array_elements_have_no_key()
+{
+    // The first element ends with a nested object, its last key must not
+    // become the path of the second element
+    const char body[] = "{\"nodes\":[{\"name\":\"a\",\"stars\":{\"count\":1}},{\"name\":\"b\"}],"
+                        "\"owner\":{\"name\":\"c\"}}";
+
+    NameStream stream;
+    for (size_t i = 0; i < strlen(body); i += 3)
+        stream.feed(body + i, std::min<size_t>(3, strlen(body) - i));
+
+    TEST_ASSERT_TRUE(stream.complete());
+    TEST_ASSERT_EQUAL_UINT32(3, stream.names.size());
+    TEST_ASSERT_EQUAL_STRING("a", stream.names[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("", stream.parents[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("b", stream.names[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("", stream.parents[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("c", stream.names[2].c_str());
+    TEST_ASSERT_EQUAL_STRING("owner", stream.parents[2].c_str());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_profile_is_replayed);
+    RUN_TEST(test_graphql_body_reaches_server);
+    RUN_TEST(test_missing_user_is_not_found);
+    RUN_TEST(test_unreachable_server_fails);
+    RUN_TEST(test_injected_faults);
+    RUN_TEST(test_latency_distribution);
+    RUN_TEST(test_stream_array_elements_have_no_key);
+    return UNITY_END();
+}
@@ -0,0 +1,349 @@
+/*
+ * Created on: 2026-10-18
+ * Author(s): Toni Fey
+ * License: MIT
+ * Description: Drives the WiFiManager connection paths with a simulated radio
+ *              that delivers its events late from a driver thread, like the
+ *              event task of the ESP32. The tests run as consecutive wakes,
+ *              the RTC state of one wake is the input of the next.
+ */
+
+#include <unity.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include "WiFiManager/WiFiManager.h"
+
+struct AccessPoint
+{
+    const char *ssid;
+    const char *password;
+    uint8_t bssid[6];
+    int32_t channel;
+    int8_t rssi;
+};
+
+class SimulatedRadio : public WiFiRadio
+{
+public:
+    // Delay of the events after the call that caused them
+    uint32_t rejectMs = 20;
+    uint32_t connectMs = 150;
+    uint32_t disconnectMs = 100;
+    // The first association is dropped and retried by the driver
+    bool dropFirstAssociation = false;
+
+    std::vector<AccessPoint> accessPoints;
+    uint32_t scans = 0;
+    uint32_t attempts = 0;
+
+    SimulatedRadio() : _driver([this]()
+                               { deliver(); }) {}
+
+    ~SimulatedRadio() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopped = true;
+        }
+        _changed.notify_all();
+        _driver.join();
+    }
+
+    void start(const char *, EventHandler handler) override { _handler = handler; }
+
+    void begin(const char *ssid, const char *password, const int32_t channel, const uint8_t *bssid,
+               const WiFiConnection *) override
+    {
+        attempts++;
+        _connected = nullptr;
+        _attempt++;
+
+        for (const AccessPoint &ap : accessPoints)
+        {
+            if (strcmp(ap.ssid, ssid) != 0)
+                continue;
+            if (bssid != nullptr && (memcmp(ap.bssid, bssid, 6) != 0 || ap.channel != channel))
+                continue;
+            if (strcmp(ap.password, password) != 0)
+                break;
+
+            _connected = &ap;
+            if (dropFirstAssociation)
+                post(Event::Disconnected, rejectMs);
+            post(Event::GotIP, connectMs);
+            return;
+        }
+
+        post(Event::Disconnected, rejectMs);
+    }
+
+    void disconnect() override
+    {
+        _connected = nullptr;
+        _attempt++;
+        post(Event::Disconnected, disconnectMs);
+    }
+
+    void off() override { _connected = nullptr; }
+
+    int16_t scan() override
+    {
+        scans++;
+        return accessPoints.size();
+    }
+
+    bool scanResult(const int16_t index, WiFiScanResult &result) const override
+    {
+        const AccessPoint &ap = accessPoints[index];
+        strlcpy(result.ssid, ap.ssid, sizeof(result.ssid));
+        result.rssi = ap.rssi;
+        result.channel = ap.channel;
+        memcpy(result.bssid, ap.bssid, 6);
+        return true;
+    }
+
+    void endScan() override {}
+
+    void connection(WiFiConnection &connection) const override
+    {
+        connection = {};
+        if (_connected == nullptr)
+            return;
+        connection.channel = _connected->channel;
+        memcpy(connection.bssid, _connected->bssid, 6);
+        connection.ip = 0x0a00a8c0;
+        connection.gateway = 0x0100a8c0;
+        connection.subnet = 0x00ffffff;
+        connection.dns = 0x0100a8c0;
+    }
+
+    int8_t rssi() const override { return _connected != nullptr ? _connected->rssi : 0; }
+
+    // Wait until every queued event was delivered
+    void settle()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _changed.wait(lock, [this]()
+                      { return _pending.empty(); });
+    }
+
+private:
+    struct Pending
+    {
+        uint32_t due;
+        uint32_t order;
+        uint32_t attempt;
+        Event event;
+
+        bool operator>(const Pending &other) const
+        {
+            return due != other.due ? due > other.due : order > other.order;
+        }
+    };
+
+    void post(const Event event, const uint32_t delayMs)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.push({millis() + delayMs, _order++, _attempt, event});
+        _changed.notify_all();
+    }
+
+    void deliver()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (!_stopped)
+        {
+            if (_pending.empty())
+            {
+                _changed.wait(lock);
+                continue;
+            }
+
+            const Pending next = _pending.top();
+            const uint32_t now = millis();
+            if ((int32_t)(next.due - now) > 0)
+            {
+                _changed.wait_for(lock, std::chrono::milliseconds(next.due - now));
+                continue;
+            }
+
+            _pending.pop();
+
+            // An address is only assigned while its attempt is still running
+            if (next.event == Event::GotIP && next.attempt != _attempt)
+                continue;
+
+            lock.unlock();
+            if (_handler != nullptr)
+                _handler(next.event);
+            lock.lock();
+            _changed.notify_all();
+        }
+    }
+
+    EventHandler _handler = nullptr;
+    const AccessPoint *_connected = nullptr;
+
+    std::mutex _mutex;
+    std::condition_variable _changed;
+    std::priority_queue<Pending, std::vector<Pending>, std::greater<Pending>> _pending;
+    uint32_t _order = 0;
+    std::atomic<uint32_t> _attempt{0};
+    bool _stopped = false;
+    std::thread _driver;
+};
+
+static SimulatedRadio radio;
+
+void setUp()
+{
+    radio.settle();
+    radio.scans = 0;
+    radio.attempts = 0;
+}
+
+void tearDown() {}
+
+void test_stale_disconnect_does_not_abort_next_network()
+{
+    KnownNetworks networks;
+    networks.load();
+    TEST_ASSERT_TRUE(networks.add("backup", "secret"));
+
+    // The strongest network rejects the password, the next one is reachable.
+    // The disconnect of the rejected attempt is reported after the next
+    // attempt started and must not be taken as its failure.
+    radio.accessPoints = {
+        {WIFI_SSID, "changed", {1, 1, 1, 1, 1, 1}, 1, -40},
+        {"backup", "secret", {2, 2, 2, 2, 2, 2}, 6, -70},
+    };
+
+    WiFiManager manager(radio);
+    TEST_ASSERT_TRUE(manager.init());
+    TEST_ASSERT_EQUAL_UINT32(1, radio.scans);
+    TEST_ASSERT_EQUAL_UINT32(2, radio.attempts);
+    TEST_ASSERT_EQUAL_INT(-70, manager.RSSI());
+    manager.shutdown();
+}
+
+void test_next_wake_uses_fast_path()
+{
+    WiFiManager manager(radio);
+    TEST_ASSERT_TRUE(manager.init());
+    TEST_ASSERT_EQUAL_UINT32(0, radio.scans);
+    TEST_ASSERT_EQUAL_UINT32(1, radio.attempts);
+    TEST_ASSERT_EQUAL_INT(-70, manager.RSSI());
+    manager.shutdown();
+}
+
+void test_moved_access_point_refreshes_cache()
+{
+    // The access point moved to another channel, the cached BSSID and the
+    // ranked candidates are outdated and only a new scan finds it
+    radio.accessPoints[1] = {"backup", "secret", {3, 3, 3, 3, 3, 3}, 11, -60};
+
+    const uint32_t start = millis();
+    WiFiManager manager(radio);
+    TEST_ASSERT_TRUE(manager.init());
+
+    // The fast path fails fast, the outdated candidate waits for the full timeout
+    TEST_ASSERT_TRUE(millis() - start >= 2 * Network::Timeout);
+    TEST_ASSERT_EQUAL_UINT32(1, radio.scans);
+    TEST_ASSERT_EQUAL_INT(-60, manager.RSSI());
+    manager.shutdown();
+
+    radio.settle();
+    radio.scans = 0;
+    radio.attempts = 0;
+
+    WiFiManager next(radio);
+    TEST_ASSERT_TRUE(next.init());
+    TEST_ASSERT_EQUAL_UINT32(0, radio.scans);
+    TEST_ASSERT_EQUAL_UINT32(1, radio.attempts);
+    next.shutdown();
+}
+
+void test_slow_dhcp_after_dropped_association()
+{
+    // The stored fast path gives up on the dropped association, the ranked
+    // candidates wait through it and a DHCP server slower than the fast path.
+    // The network with the changed password is still ranked first.
+    radio.dropFirstAssociation = true;
+    radio.connectMs = Network::FastPathTimeout + 500;
+
+    WiFiManager manager(radio);
+    const bool connected = manager.init();
+    radio.dropFirstAssociation = false;
+    radio.connectMs = 150;
+
+    TEST_ASSERT_TRUE(connected);
+    TEST_ASSERT_EQUAL_UINT32(0, radio.scans);
+    TEST_ASSERT_EQUAL_UINT32(3, radio.attempts);
+    TEST_ASSERT_EQUAL_INT(-60, manager.RSSI());
+    manager.shutdown();
+}
+
+void test_unreachable_networks_fail()
+{
+    radio.accessPoints.clear();
+
+    WiFiManager manager(radio);
+    TEST_ASSERT_FALSE(manager.init());
+    manager.shutdown();
+}
+
+void test_empty_slot_keeps_keys_in_sync()
+{
+    Preferences::erase();
+
+    // Slot 1 lost its name, e.g. after an interrupted write
+    Preferences preferences;
+    preferences.begin("wifi", false);
+    preferences.putString("ssid0", WIFI_SSID);
+    preferences.putString("pass0", WIFI_PASSWORD);
+    preferences.putString("ssid1", "");
+    preferences.putString("ssid2", "office");
+    preferences.putString("pass2", "old");
+    preferences.putUChar("count", 3);
+    preferences.end();
+
+    KnownNetworks networks;
+    networks.load();
+    TEST_ASSERT_EQUAL_UINT8(2, networks.count());
+    TEST_ASSERT_EQUAL_STRING("office", networks[1].ssid);
+
+    // A new network goes to index 2 and must not overwrite the slot office was read from
+    TEST_ASSERT_TRUE(networks.add("guest", "welcome"));
+
+    KnownNetworks reloaded;
+    reloaded.load();
+    TEST_ASSERT_EQUAL_UINT8(3, reloaded.count());
+    TEST_ASSERT_EQUAL_STRING("office", reloaded[1].ssid);
+    TEST_ASSERT_EQUAL_STRING("old", reloaded[1].password);
+    TEST_ASSERT_EQUAL_STRING("guest", reloaded[2].ssid);
+
+    // Updating the compacted entry has to reach the slot load() reads it from
+    TEST_ASSERT_TRUE(reloaded.add("office", "new"));
+    KnownNetworks updated;
+    updated.load();
+    TEST_ASSERT_EQUAL_UINT8(3, updated.count());
+    TEST_ASSERT_EQUAL_STRING("new", updated[1].password);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_stale_disconnect_does_not_abort_next_network);
+    RUN_TEST(test_next_wake_uses_fast_path);
+    RUN_TEST(test_moved_access_point_refreshes_cache);
+    RUN_TEST(test_slow_dhcp_after_dropped_association);
+    RUN_TEST(test_unreachable_networks_fail);
+    RUN_TEST(test_empty_slot_keeps_keys_in_sync);
+    return UNITY_END();
+}